@@ -218,7 +218,9 @@ typedef enum {
 typedef enum {
     NO_RESIZE = 0,
     RESIZE_BILINEAR,
-    RESIZE_AREA
+    RESIZE_AREA,
+    RESIZE_NEAREST,
+    RESIZE_BICUBIC
 }resize_alg_e;
 
 /**
@@ -108,7 +108,9 @@ std::map<IE::Layout, layout_e> layout_map = {{IE::Layout::ANY, layout_e::ANY},
 
 std::map<IE::ResizeAlgorithm, resize_alg_e> resize_alg_map = {{IE::ResizeAlgorithm::NO_RESIZE, resize_alg_e::NO_RESIZE},
                                                                 {IE::ResizeAlgorithm::RESIZE_AREA, resize_alg_e::RESIZE_AREA},
-                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR}};
+                                                                {IE::ResizeAlgorithm::RESIZE_BILINEAR, resize_alg_e::RESIZE_BILINEAR},
+                                                                {IE::ResizeAlgorithm::RESIZE_NEAREST, resize_alg_e::RESIZE_NEAREST},
+                                                                {IE::ResizeAlgorithm::RESIZE_BICUBIC, resize_alg_e::RESIZE_BICUBIC}};
 
 std::map<IE::ColorFormat, colorformat_e> colorformat_map = {{IE::ColorFormat::RAW, colorformat_e::RAW},
                                                             {IE::ColorFormat::RGB, colorformat_e::RGB},
@@ -25,6 +25,13 @@ namespace HeteroConfigParams {
  * @brief Shortcut for defining HETERO configuration keys
  */
 #define HETERO_CONFIG_KEY(name) InferenceEngine::HeteroConfigParams::_CONFIG_KEY(HETERO_##name)
+
+/**
+ * @def HETERO_CONFIG_VALUE(name)
+ * @brief Shortcut for HETERO configuration values
+ */
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
+
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
@@ -35,5 +42,17 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key selects how layers are assigned to devices if affinities are not set by user:
+ * HETERO_AFFINITY (default) executes each layer on the first device from TARGET_FALLBACK list which supports it,
+ * HETERO_MIN_LATENCY places layers to minimize estimated latency using per layer compute and memory costs
+ * together with the cost of data transfers between devices, so small fragments are merged to their neighbours.
+ * Estimated cost of the partition is written to hetero_partition_<network name>.txt if HETERO_DUMP_GRAPH_DOT is set.
+ * HETERO_MIN_LATENCY is applied to networks represented by nGraph function only.
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING_POLICY);
+DECLARE_HETERO_CONFIG_VALUE(AFFINITY);
+DECLARE_HETERO_CONFIG_VALUE(MIN_LATENCY);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
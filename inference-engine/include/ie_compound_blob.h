@@ -349,4 +349,80 @@ public:
 
     Blob::Ptr createROI(const ROI& roi) const override;
 };
+
+/**
+ * @brief Represents a blob that contains a list of images, one per batch item of the network input
+ *
+ * Images may have different sizes, e.g. ROIs of one frame. With input pre-processing enabled, each image is
+ * resized and converted into the corresponding batch item of the network input. Images are memory,
+ * NV12 or I420 blobs of the same type and precision with batch size 1.
+ */
+class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the BatchedBlob object
+     */
+    using Ptr = std::shared_ptr<BatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const BatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const BatchedBlob>;
+
+    /**
+     * @brief A deleted default constructor
+     */
+    BatchedBlob() = delete;
+
+    /**
+     * @brief Constructs a batched blob from a vector of images
+     *
+     * @param blobs A vector of images that is copied to this object
+     */
+    explicit BatchedBlob(const std::vector<Blob::Ptr>& blobs);
+
+    /**
+     * @brief Constructs a batched blob from a vector of images
+     *
+     * @param blobs A vector of images that is moved to this object
+     */
+    explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
+
+    /**
+     * @brief A virtual destructor. It is made out of line for RTTI to
+     * work correctly on some platforms.
+     */
+    virtual ~BatchedBlob();
+
+    /**
+     * @brief A copy constructor
+     */
+    BatchedBlob(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A copy assignment operator
+     */
+    BatchedBlob& operator=(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A move constructor
+     */
+    BatchedBlob(BatchedBlob&& blob) = default;
+
+    /**
+     * @brief A move assignment operator
+     */
+    BatchedBlob& operator=(BatchedBlob&& blob) = default;
+
+    Blob::Ptr createROI(const ROI& roi) const override;
+};
+
+/**
+ * @brief Creates a batched blob of ROIs of one image sharing memory with the given blob
+ *
+ * @param inputBlob original blob with pre-allocated memory, a memory, NV12 or I420 blob
+ * @param rois A list of ROI objects inside of the original blob, one per batch item
+ * @return A shared pointer to the newly created BatchedBlob object
+ */
+INFERENCE_ENGINE_API_CPP(Blob::Ptr) make_shared_blob(const Blob::Ptr& inputBlob, const std::vector<ROI>& rois);
 }  // namespace InferenceEngine
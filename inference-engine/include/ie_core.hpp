@@ -100,6 +100,26 @@ public:
         const CNNNetwork& network, const std::string& deviceName,
         const std::map<std::string, std::string>& config = {});
 
+    /**
+     * @brief Creates an executable network from a network object reshaped to the given input shapes.
+     *
+     * Executable networks are cached by the network, input shapes, device name and config, so switching between
+     * previously used shapes costs a lookup instead of reshape and compilation. The passed network is not modified,
+     * a copy of it is reshaped on a cache miss. The cache is configured with the
+     * PluginConfigParams::KEY_EXEC_NETWORK_CACHE_CAPACITY and PluginConfigParams::KEY_EXEC_NETWORK_CACHE_MEMORY_BUDGET
+     * keys passed to Core::SetConfig without a device name. Only networks represented as ngraph::Function are supported.
+     *
+     * @param network CNNNetwork object acquired from Core::ReadNetwork
+     * @param inputShapes Map of pairs: (input name, input shape), inputs which are not listed keep their shapes
+     * @param deviceName Name of device to load network to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @return An executable network reference
+     */
+    ExecutableNetwork LoadNetwork(
+        const CNNNetwork& network, const ICNNNetwork::InputShapes& inputShapes, const std::string& deviceName,
+        const std::map<std::string, std::string>& config = {});
+
     /**
      * @brief Registers extension
      * @param extension Pointer to already loaded extension
@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -156,6 +158,40 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get amount of executable network memory in bytes resident on each NUMA node.
+ *
+ * Keys of the map are NUMA node ids. Memory which was not touched yet or whose placement is unknown is reported
+ * under the -1 key.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(NUMA_NODES_MEMORY_PLACEMENT, std::map<int, uint64_t>);
+
+/**
+ * @brief Metric to get whether outputs of executable network are written directly to user blobs.
+ *
+ * Value for an output is true if it was inferred at least once and was never copied from internal memory.
+ * Layout and precision of the user blob should match the ones returned by InferRequest::GetBlob.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(OUTPUTS_ZERO_COPY, std::map<std::string, bool>);
+
+/**
+ * @brief Metric to get an unsigned int number of Core::LoadNetwork calls with input shapes served from the executable
+ * network cache. Requested from Core::GetMetric with an empty device name.
+ */
+DECLARE_METRIC_KEY(EXEC_NETWORK_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get an unsigned int number of Core::LoadNetwork calls with input shapes which reshaped and loaded
+ * the network. Requested from Core::GetMetric with an empty device name.
+ */
+DECLARE_METRIC_KEY(EXEC_NETWORK_CACHE_MISSES, unsigned int);
+
+/**
+ * @brief Metric to get an unsigned int number of executable networks evicted from the cache to fit its capacity or
+ * memory budget. Requested from Core::GetMetric with an empty device name.
+ */
+DECLARE_METRIC_KEY(EXEC_NETWORK_CACHE_EVICTIONS, unsigned int);
+
 }  // namespace Metrics
 
 /**
@@ -360,5 +396,23 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The key to set maximum number of executable networks kept by Core::LoadNetwork with input shapes.
+ *
+ * Core level option, should be passed to Core::SetConfig without a device name. Value is a non-negative integer,
+ * "0" disables the cache. Default value is "8".
+ */
+DECLARE_CONFIG_KEY(EXEC_NETWORK_CACHE_CAPACITY);
+
+/**
+ * @brief The key to limit estimated memory footprint of executable networks kept by Core::LoadNetwork with input
+ * shapes, in megabytes.
+ *
+ * Core level option, should be passed to Core::SetConfig without a device name. The footprint of a network is
+ * estimated as a total size of its constants and intermediate tensors. Least recently used networks are evicted
+ * when the limit is exceeded. Default value is "0" which means no limit.
+ */
+DECLARE_CONFIG_KEY(EXEC_NETWORK_CACHE_MEMORY_BUDGET);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
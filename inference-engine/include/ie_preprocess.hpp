@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <vector>
 
@@ -47,7 +49,28 @@ enum MeanVariant {
  * @enum ResizeAlgorithm
  * @brief Represents the list of supported resize algorithms.
  */
-enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA };
+enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA, RESIZE_NEAREST, RESIZE_BICUBIC };
+
+/**
+ * @brief This structure describes placement of a source image inside the network input
+ *        when aspect-preserving (letterbox) resize is used
+ */
+struct LetterboxTransform {
+    /** @brief Scale factor applied to both dimensions of the source image */
+    float scale = 1.f;
+
+    /** @brief Left padding of the resized image, in pixels */
+    size_t offsetX = 0;
+
+    /** @brief Top padding of the resized image, in pixels */
+    size_t offsetY = 0;
+
+    /** @brief Width of the resized image, in pixels */
+    size_t width = 0;
+
+    /** @brief Height of the resized image, in pixels */
+    size_t height = 0;
+};
 
 /**
  * @brief This class stores pre-process information for the input
@@ -63,6 +86,10 @@ class PreProcessInfo {
     // Color format to be used in on-demand color conversions applied to input before inference
     ColorFormat _colorFormat = ColorFormat::RAW;
 
+    // Aspect-preserving resize and the value the rest of the input is filled with
+    bool _letterbox = false;
+    float _padValue = 0.f;
+
 public:
     /**
      * @brief Overloaded [] operator to safely get the channel by an index
@@ -221,5 +248,69 @@ public:
     ColorFormat getColorFormat() const {
         return _colorFormat;
     }
+
+    /**
+     * @brief Enables aspect-preserving (letterbox) resize
+     *
+     * The input image is scaled with the configured resize algorithm by the same factor in both
+     * dimensions to fit the network input, centered and the rest of the input is filled with the pad value.
+     * Has no effect if resize algorithm is ResizeAlgorithm::NO_RESIZE
+     *
+     * @param enable Whether letterbox resize is applied
+     * @param padValue Value of padded pixels, saturated to the precision of the network input
+     */
+    void setLetterbox(bool enable, float padValue = 0.f) {
+        _letterbox = enable;
+        _padValue = padValue;
+    }
+
+    /**
+     * @brief Checks whether letterbox resize is enabled
+     *
+     * @return true if letterbox resize is enabled
+     */
+    bool getLetterbox() const {
+        return _letterbox;
+    }
+
+    /**
+     * @brief Gets a value of pixels padded by letterbox resize
+     *
+     * @return Pad value
+     */
+    float getPadValue() const {
+        return _padValue;
+    }
+
+    /**
+     * @brief Computes placement of an image inside the network input for letterbox resize
+     *
+     * Pre-processing uses the same computation, so the result can be used to map inference results
+     * back to the coordinates of the source image: x_src = (x_dst - offsetX) / scale
+     *
+     * @param srcWidth Width of the source image
+     * @param srcHeight Height of the source image
+     * @param dstWidth Width of the network input
+     * @param dstHeight Height of the network input
+     * @return Scale and offsets of the resized image
+     */
+    static LetterboxTransform getLetterboxTransform(size_t srcWidth, size_t srcHeight,
+                                                    size_t dstWidth, size_t dstHeight) {
+        if (srcWidth == 0 || srcHeight == 0 || dstWidth == 0 || dstHeight == 0) {
+            THROW_IE_EXCEPTION << "Letterbox resize is called with empty image";
+        }
+        LetterboxTransform transform;
+        transform.scale = (std::min)(static_cast<float>(dstWidth) / srcWidth,
+                                     static_cast<float>(dstHeight) / srcHeight);
+        const auto scaled = [&](size_t src, size_t dst) {
+            const auto size = static_cast<size_t>(std::round(src * transform.scale));
+            return (std::max)(size_t(1), (std::min)(size, dst));
+        };
+        transform.width = scaled(srcWidth, dstWidth);
+        transform.height = scaled(srcHeight, dstHeight);
+        transform.offsetX = (dstWidth - transform.width) / 2;
+        transform.offsetY = (dstHeight - transform.height) / 2;
+        return transform;
+    }
 };
 }  // namespace InferenceEngine
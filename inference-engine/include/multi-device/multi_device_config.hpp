@@ -26,6 +26,12 @@ namespace MultiDeviceConfigParams {
  */
 #define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
@@ -34,5 +40,37 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option, which selects a device for every infer request:
+ * MULTI_PRIORITY (default) sends a request to the first device in DEVICE_PRIORITIES list which has an idle request,
+ * MULTI_EARLIEST_COMPLETION sends it to the device with the earliest expected completion time based on
+ * average device latency, so a request may wait for a busy fast device instead of being sent to an idle slow one,
+ * MULTI_THROUGHPUT_PROPORTIONAL keeps load of devices proportional to their measured throughput
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(EARLIEST_COMPLETION);
+DECLARE_MULTI_CONFIG_VALUE(THROUGHPUT_PROPORTIONAL);
+
 }  // namespace MultiDeviceConfigParams
+
+/**
+ * @def MULTI_METRIC(name)
+ * @brief A macro which provides a MULTI-mangled name for metric with name `name`
+ */
+#define MULTI_METRIC(name) METRIC_KEY(MULTI_##name)
+#define DECLARE_MULTI_METRIC(name, ...) DECLARE_METRIC_KEY(MULTI_##name, __VA_ARGS__)
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get runtime statistics of each device of MULTI executable network.
+ *
+ * Values for a device: LATENCY_MS is an exponentially weighted moving average of the device request latency,
+ * QUEUE_DEPTH is a number of requests being executed by the device, NUM_REQUESTS is a number of device requests
+ * used by MULTI and COMPLETED_REQUESTS is a number of completed requests
+ */
+DECLARE_MULTI_METRIC(DEVICE_STATISTICS, std::map<std::string, std::map<std::string, double>>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -100,6 +100,34 @@ static const char dump_config_message[] = "Optional. Path to XML/YAML/JSON file
 static const char shape_message[] = "Optional. Set shape for input. For example, \"input1[1,3,224,224],input2[1,4]\" or \"[1,3,224,224]\""
                                     " in case of one input size.";
 
+// @brief message for open-loop request rate option
+static const char qps_message[] = "Optional. Enable open-loop mode: submit inference requests with the given rate (requests per second) "
+                                  "independently of their completion and report latency percentiles including time spent "
+                                  "waiting for an idle infer request. Works only with async API.";
+
+// @brief message for arrival process option
+static const char arrival_message[] = "Optional. Arrival process of open-loop requests: \"poisson\" (default) or \"constant\" intervals.";
+
+// @brief message for request rate sweep option
+static const char qps_sweep_message[] = "Optional. Comma-separated list of request rates to run in open-loop mode one after another, "
+                                        "each for the time or number of iterations limit, to find the highest sustained rate.";
+
+// @brief message for co-located models option
+static const char models_message[] = "Optional. Comma-separated list of paths to models to load on the same device and run "
+                                     "concurrently, each with own infer requests. Used instead of -m. Works only with async API.";
+
+// @brief message for per-model streams option
+static const char models_nstreams_message[] = "Optional. Comma-separated list of numbers of streams for models from -models option "
+                                              "or a single value for all of them. Supported for CPU or GPU device.";
+
+// @brief message for per-model infer requests option
+static const char models_nireq_message[] = "Optional. Comma-separated list of numbers of infer requests for models from -models "
+                                           "option or a single value for all of them.";
+
+// @brief message for per-model request rate option
+static const char models_qps_message[] = "Optional. Comma-separated list of request rates for models from -models option or a "
+                                         "single value for all of them, 0 runs the model in closed loop. Defaults to -qps value.";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -187,6 +215,27 @@ DEFINE_string(dump_config, "", dump_config_message);
 /// @brief Define flag for input shape <br>
 DEFINE_string(shape, "", shape_message);
 
+/// @brief Define flag for open-loop request rate <br>
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Define flag for open-loop arrival process <br>
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Define flag for open-loop request rates sweep <br>
+DEFINE_string(qps_sweep, "", qps_sweep_message);
+
+/// @brief Define flag for co-located models <br>
+DEFINE_string(models, "", models_message);
+
+/// @brief Define flag for numbers of streams per co-located model <br>
+DEFINE_string(models_nstreams, "", models_nstreams_message);
+
+/// @brief Define flag for numbers of infer requests per co-located model <br>
+DEFINE_string(models_nireq, "", models_nireq_message);
+
+/// @brief Define flag for request rates per co-located model <br>
+DEFINE_string(models_qps, "", models_qps_message);
+
 /// @brief Define flag for quantization bits (default 16)
 DEFINE_int32(qb, 16, gna_qb_message);
 
@@ -213,6 +262,15 @@ static void showUsage() {
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
+    std::cout << std::endl << "  Open-loop load options:" << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << "    -arrival \"<process>\"      " << arrival_message << std::endl;
+    std::cout << "    -qps_sweep \"<list>\"       " << qps_sweep_message << std::endl;
+    std::cout << std::endl << "  Co-location options:" << std::endl;
+    std::cout << "    -models \"<list>\"          " << models_message << std::endl;
+    std::cout << "    -models_nstreams \"<list>\" " << models_nstreams_message << std::endl;
+    std::cout << "    -models_nireq \"<list>\"    " << models_nireq_message << std::endl;
+    std::cout << "    -models_qps \"<list>\"      " << models_qps_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
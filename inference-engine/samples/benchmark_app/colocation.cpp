@@ -0,0 +1,238 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "colocation.hpp"
+#include "inputs_filling.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::vector<std::string> splitList(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+// returns a value for every model, a single value is repeated
+std::vector<std::string> perModelValues(const std::string& list, size_t models, const std::string& option) {
+    auto values = splitList(list);
+    if (values.empty()) {
+        return std::vector<std::string>(models);
+    }
+    if (values.size() == 1) {
+        return std::vector<std::string>(models, values.front());
+    }
+    if (values.size() != models) {
+        throw std::logic_error("-" + option + " option should contain one value or a value for every model, but " +
+                               std::to_string(values.size()) + " values are given for " + std::to_string(models) + " models");
+    }
+    return values;
+}
+
+}  // namespace
+
+std::vector<ColocatedModel> parseColocatedModels(const std::string& paths,
+                                                 const std::string& nstreams,
+                                                 const std::string& nireq,
+                                                 const std::string& qps,
+                                                 double defaultQps) {
+    auto modelPaths = splitList(paths);
+    if (modelPaths.empty()) {
+        throw std::logic_error("-models option should contain at least one model path");
+    }
+    auto modelsNStreams = perModelValues(nstreams, modelPaths.size(), "models_nstreams");
+    auto modelsNIreq = perModelValues(nireq, modelPaths.size(), "models_nireq");
+    auto modelsQps = perModelValues(qps, modelPaths.size(), "models_qps");
+
+    std::vector<ColocatedModel> models;
+    for (size_t i = 0; i < modelPaths.size(); i++) {
+        ColocatedModel model;
+        model.path = modelPaths[i];
+        model.nstreams = modelsNStreams[i];
+        try {
+            model.nireq = modelsNIreq[i].empty() ? 0 : static_cast<uint32_t>(std::stoul(modelsNIreq[i]));
+            model.qps = modelsQps[i].empty() ? defaultQps : std::stod(modelsQps[i]);
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse number of infer requests or request rate for model " + model.path);
+        }
+        if (model.qps < 0.0) {
+            throw std::logic_error("Request rate for model " + model.path + " should not be negative");
+        }
+        models.push_back(model);
+    }
+    return models;
+}
+
+void benchmarkColocatedModels(Core& ie,
+                              const std::string& device_name,
+                              const std::vector<ColocatedModel>& models,
+                              const std::vector<std::string>& inputFiles,
+                              size_t batchSize,
+                              uint64_t durationNs,
+                              uint64_t niter,
+                              bool poisson,
+                              const std::shared_ptr<StatisticsReport>& statistics) {
+    struct Instance {
+        ColocatedModel model;
+        std::string name;
+        std::string nstreams;
+        size_t batchSize = 1;
+        uint32_t nireq = 0;
+        ExecutableNetwork network;
+        std::unique_ptr<InferRequestsQueue> queue;
+        OpenLoopResult result;
+    };
+    std::vector<std::unique_ptr<Instance>> instances;
+
+    for (const auto& model : models) {
+        std::unique_ptr<Instance> instance(new Instance);
+        instance->model = model;
+        slog::info << "Loading " << model.path << slog::endl;
+
+        CNNNetwork cnnNetwork = ie.ReadNetwork(model.path);
+        const InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
+        if (inputInfo.empty()) {
+            throw std::logic_error("no inputs info is provided for " + model.path);
+        }
+        if (batchSize != 0 && cnnNetwork.getBatchSize() != batchSize) {
+            auto shapes = cnnNetwork.getInputShapes();
+            if (adjustShapesBatch(shapes, batchSize, inputInfo)) {
+                cnnNetwork.reshape(shapes);
+            }
+        }
+        for (auto& item : inputInfo) {
+            if (isImage(item.second)) {
+                item.second->setPrecision(Precision::U8);
+            }
+        }
+        instance->name = cnnNetwork.getName();
+        instance->batchSize = cnnNetwork.getBatchSize();
+
+        std::map<std::string, std::string> config;
+        if (!model.nstreams.empty()) {
+            if (device_name != "CPU" && device_name != "GPU") {
+                throw std::logic_error("Number of streams per model is supported only for CPU or GPU device");
+            }
+            config[device_name + "_THROUGHPUT_STREAMS"] = model.nstreams;
+        }
+        instance->network = ie.LoadNetwork(cnnNetwork, device_name, config);
+        if (device_name == "CPU" || device_name == "GPU") {
+            instance->nstreams = instance->network.GetConfig(device_name + "_THROUGHPUT_STREAMS").as<std::string>();
+        }
+
+        instance->nireq = model.nireq;
+        if (instance->nireq == 0) {
+            instance->nireq = instance->network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        }
+        instance->queue.reset(new InferRequestsQueue(instance->network, instance->nireq));
+        const ConstInputsDataMap info(instance->network.GetInputsInfo());
+        fillBlobs(inputFiles, instance->batchSize, info, instance->queue->requests);
+
+        // warming up - out of scope
+        auto inferRequest = instance->queue->getIdleRequest();
+        inferRequest->startAsync();
+        instance->queue->waitAll();
+        inferRequest->wait();
+
+        slog::info << "Model " << instance->name << ": batch " << instance->batchSize << ", " << instance->nireq
+                   << " infer requests" << (instance->nstreams.empty() ? "" : ", " + instance->nstreams + " streams")
+                   << ", " << (model.qps > 0.0 ? double_to_string(model.qps) + " QPS open-loop" : std::string("closed loop"))
+                   << slog::endl;
+        instances.push_back(std::move(instance));
+    }
+
+    slog::info << "Running " << instances.size() << " models concurrently" << slog::endl;
+    std::vector<std::exception_ptr> errors(instances.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < instances.size(); i++) {
+        threads.emplace_back([&, i] {
+            auto& instance = *instances[i];
+            try {
+                if (instance.model.qps > 0.0) {
+                    instance.result = runOpenLoop(*instance.queue, instance.model.qps, poisson, durationNs, niter);
+                } else {
+                    instance.result = runClosedLoop(*instance.queue, instance.nireq, durationNs, niter);
+                }
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    LatencyHistogram aggregateLatency;
+    double aggregateFps = 0.0;
+    uint64_t aggregateCount = 0;
+    std::vector<StatisticsReport::ColocatedModelPoint> points;
+    for (const auto& instance : instances) {
+        const auto& result = instance->result;
+        auto fps = instance->batchSize * result.achievedQps;
+        aggregateFps += fps;
+        aggregateCount += result.count;
+        aggregateLatency.record(instance->queue->getLatencies());
+        points.push_back({instance->name, instance->nstreams, instance->nireq, instance->model.qps, result.count, fps,
+                          result.latency.percentile(50), result.latency.percentile(90), result.latency.percentile(99),
+                          result.latency.max()});
+    }
+
+    std::cout << std::endl << "Co-located models:" << std::endl;
+    std::cout << std::left << std::setw(24) << "model" << std::right << std::setw(10) << "nstreams" << std::setw(8) << "nireq"
+              << std::setw(12) << "target QPS" << std::setw(10) << "count" << std::setw(12) << "FPS"
+              << std::setw(12) << "p50, ms" << std::setw(12) << "p90, ms" << std::setw(12) << "p99, ms"
+              << std::setw(12) << "max, ms" << std::endl;
+    for (const auto& point : points) {
+        std::cout << std::left << std::setw(24) << point.model << std::right << std::setw(10) << point.nstreams
+                  << std::setw(8) << point.nireq
+                  << std::setw(12) << (point.targetQps > 0.0 ? double_to_string(point.targetQps) : std::string("-"))
+                  << std::setw(10) << point.count << std::setw(12) << double_to_string(point.throughput)
+                  << std::setw(12) << double_to_string(point.p50) << std::setw(12) << double_to_string(point.p90)
+                  << std::setw(12) << double_to_string(point.p99) << std::setw(12) << double_to_string(point.max)
+                  << std::endl;
+    }
+    std::cout << std::left << std::setw(24) << "total" << std::right << std::setw(10) << "" << std::setw(8) << ""
+              << std::setw(12) << "" << std::setw(10) << aggregateCount << std::setw(12) << double_to_string(aggregateFps)
+              << std::setw(12) << double_to_string(aggregateLatency.percentile(50))
+              << std::setw(12) << double_to_string(aggregateLatency.percentile(90))
+              << std::setw(12) << double_to_string(aggregateLatency.percentile(99))
+              << std::setw(12) << double_to_string(aggregateLatency.max()) << std::endl;
+
+    if (statistics) {
+        statistics->addColocatedResults(points);
+        statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                  {
+                                          {"number of co-located models", std::to_string(instances.size())},
+                                          {"total number of iterations", std::to_string(aggregateCount)},
+                                          {"aggregate throughput", double_to_string(aggregateFps)},
+                                          {"aggregate latency p50 (ms)", double_to_string(aggregateLatency.percentile(50))},
+                                          {"aggregate latency p99 (ms)", double_to_string(aggregateLatency.percentile(99))},
+                                  });
+    }
+}
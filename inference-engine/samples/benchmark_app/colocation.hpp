@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "open_loop.hpp"
+#include "statistics_report.hpp"
+
+/// @brief Model executed concurrently with other models on the same Core
+struct ColocatedModel {
+    std::string path;
+    std::string nstreams;   // empty to use device configuration
+    uint32_t nireq = 0;     // 0 to use OPTIMAL_NUMBER_OF_INFER_REQUESTS metric
+    double qps = 0.0;       // 0 for closed loop
+};
+
+/// @brief Builds models list from comma-separated lists of paths and per-model parameters,
+/// a parameter list with a single value applies to all models
+std::vector<ColocatedModel> parseColocatedModels(const std::string& paths,
+                                                 const std::string& nstreams,
+                                                 const std::string& nireq,
+                                                 const std::string& qps,
+                                                 double defaultQps);
+
+/// @brief Loads all @p models to @p device_name on @p ie and runs them concurrently, each in own thread with own
+/// infer requests, then reports per model and aggregate throughput and latency
+void benchmarkColocatedModels(InferenceEngine::Core& ie,
+                              const std::string& device_name,
+                              const std::vector<ColocatedModel>& models,
+                              const std::vector<std::string>& inputFiles,
+                              size_t batchSize,
+                              uint64_t durationNs,
+                              uint64_t niter,
+                              bool poisson,
+                              const std::shared_ptr<StatisticsReport>& statistics);
@@ -43,6 +43,16 @@ public:
 
     void startAsync() {
         _startTime = Time::now();
+        _queueingTime = ns::zero();
+        _request.StartAsync();
+    }
+
+    /// @brief Starts the request which was due at @p scheduledTime, time spent waiting for an idle request is
+    /// accounted in the latency
+    void startAsync(Time::time_point scheduledTime) {
+        auto now = Time::now();
+        _startTime = std::min(scheduledTime, now);
+        _queueingTime = std::chrono::duration_cast<ns>(now - _startTime);
         _request.StartAsync();
     }
 
@@ -70,10 +80,15 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueingTimeInMilliseconds() const {
+        return static_cast<double>(_queueingTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    ns _queueingTime = ns::zero();
     size_t _id;
     QueueCallbackFunction _callbackQueue;
 };
@@ -102,6 +117,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingTimes.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -112,6 +128,7 @@ public:
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueingTimes.push_back(requests.at(id)->getQueueingTimeInMilliseconds());
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -135,6 +152,10 @@ public:
         return _latencies;
     }
 
+    std::vector<double> getQueueingTimes() {
+        return _queueingTimes;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -144,4 +165,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingTimes;
 };
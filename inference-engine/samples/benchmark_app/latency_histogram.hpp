@@ -0,0 +1,97 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/// @brief HDR-style histogram of latencies: values are counted in microseconds in log-linear buckets, so every
+/// reported percentile is within 1/2^subBucketBits relative error regardless of the latency range
+class LatencyHistogram final {
+public:
+    explicit LatencyHistogram(unsigned subBucketBits = 7) : _subBucketBits(subBucketBits) {}
+
+    void record(double latencyMs) {
+        auto value = static_cast<uint64_t>(std::llround(std::max(0.0, latencyMs) * 1000.0));
+        auto index = bucketIndex(value);
+        if (index >= _counts.size()) {
+            _counts.resize(index + 1, 0);
+        }
+        _counts[index]++;
+        _count++;
+        _sum += latencyMs;
+        _max = std::max(_max, latencyMs);
+        _min = std::min(_min, latencyMs);
+    }
+
+    void record(const std::vector<double>& latenciesMs) {
+        for (auto latency : latenciesMs) {
+            record(latency);
+        }
+    }
+
+    /// @brief Returns latency in milliseconds which is not exceeded by @p percent of recorded values
+    double percentile(double percent) const {
+        if (_count == 0) {
+            return 0.0;
+        }
+        auto target = static_cast<uint64_t>(std::ceil(std::min(100.0, std::max(0.0, percent)) / 100.0 * _count));
+        target = std::max<uint64_t>(target, 1);
+        uint64_t accumulated = 0;
+        for (size_t index = 0; index < _counts.size(); index++) {
+            accumulated += _counts[index];
+            if (accumulated >= target) {
+                return std::min(_max, std::max(_min, bucketUpperValue(index) / 1000.0));
+            }
+        }
+        return _max;
+    }
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    double mean() const {
+        return _count == 0 ? 0.0 : _sum / _count;
+    }
+
+    double max() const {
+        return _count == 0 ? 0.0 : _max;
+    }
+
+private:
+    // values below 2^(bits + 1) have own buckets, larger ones share buckets of 2^shift values
+    size_t bucketIndex(uint64_t value) const {
+        const uint64_t subBuckets = 1ULL << _subBucketBits;
+        if (value < 2 * subBuckets) {
+            return static_cast<size_t>(value);
+        }
+        unsigned shift = 0;
+        while ((value >> shift) >= 2 * subBuckets) {
+            shift++;
+        }
+        return static_cast<size_t>(shift * subBuckets + (value >> shift));
+    }
+
+    uint64_t bucketUpperValue(size_t index) const {
+        const uint64_t subBuckets = 1ULL << _subBucketBits;
+        if (index < 2 * subBuckets) {
+            return index;
+        }
+        uint64_t shift = index / subBuckets - 1;
+        uint64_t subBucket = index - shift * subBuckets;
+        return ((subBucket + 1) << shift) - 1;
+    }
+
+    unsigned _subBucketBits;
+    std::vector<uint64_t> _counts;
+    uint64_t _count = 0;
+    double _sum = 0.0;
+    double _max = 0.0;
+    double _min = std::numeric_limits<double>::max();
+};
@@ -19,10 +19,12 @@
 #include <samples/args_helper.hpp>
 
 #include "benchmark_app.hpp"
+#include "colocation.hpp"
 #include "infer_request_wrap.hpp"
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
+#include "open_loop.hpp"
 #include "utils.hpp"
 
 using namespace InferenceEngine;
@@ -47,8 +49,20 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
-        throw std::logic_error("Model is required but not set. Please set -m option.");
+    if (FLAGS_m.empty() && FLAGS_models.empty()) {
+        throw std::logic_error("Model is required but not set. Please set -m or -models option.");
+    }
+
+    if (!FLAGS_m.empty() && !FLAGS_models.empty()) {
+        throw std::logic_error("-m and -models options can't be used together.");
+    }
+
+    if (!FLAGS_models.empty() && FLAGS_api != "async") {
+        throw std::logic_error("Co-location mode (-models option) is supported only with async API.");
+    }
+
+    if (!FLAGS_models.empty() && !FLAGS_qps_sweep.empty()) {
+        throw std::logic_error("-qps_sweep option can't be used together with -models option.");
     }
 
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
@@ -66,6 +80,18 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if ((FLAGS_qps > 0.0 || !FLAGS_qps_sweep.empty()) && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-qps or -qps_sweep option) is supported only with async API.");
+    }
+
+    if (FLAGS_qps < 0.0) {
+        throw std::logic_error("Incorrect request rate. Please set -qps option to a positive value.");
+    }
+
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `poisson` or `constant` value.");
+    }
+
     return true;
 }
 
@@ -290,11 +316,36 @@ int main(int argc, char *argv[]) {
             ie.SetConfig(item.second, item.first);
         }
 
-        auto double_to_string = [] (const double number) {
-            std::stringstream ss;
-            ss << std::fixed << std::setprecision(2) << number;
-            return ss.str();
-        };
+        if (!FLAGS_models.empty()) {
+            // ----------------- 4-10. Loading and running co-located models -------------------------------------------
+            next_step("Co-locating models from -models option");
+
+            auto models = parseColocatedModels(FLAGS_models, FLAGS_models_nstreams, FLAGS_models_nireq,
+                                               FLAGS_models_qps, FLAGS_qps);
+            uint32_t duration_seconds = FLAGS_t;
+            if (FLAGS_t == 0 && FLAGS_niter == 0) {
+                duration_seconds = deviceDefaultDeviceDurationInSeconds(device_name);
+            }
+            if (statistics) {
+                statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                          {
+                                                  {"topology", "co-located models"},
+                                                  {"target device", device_name},
+                                                  {"API", FLAGS_api},
+                                                  {"number of models", std::to_string(models.size())},
+                                                  {"iterations num per model", std::to_string(FLAGS_niter)},
+                                                  {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
+                                          });
+            }
+            benchmarkColocatedModels(ie, device_name, models, inputFiles, FLAGS_b,
+                                     getDurationInNanoseconds(duration_seconds), FLAGS_niter,
+                                     FLAGS_arrival == "poisson", statistics);
+
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         auto get_total_ms_time = [] (Time::time_point& startTime) {
             return std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
         };
@@ -493,6 +544,19 @@ int main(int argc, char *argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        std::vector<double> openLoopRates;
+        if (!FLAGS_qps_sweep.empty()) {
+            openLoopRates = parseQpsList(FLAGS_qps_sweep);
+        } else if (FLAGS_qps > 0.0) {
+            openLoopRates.push_back(FLAGS_qps);
+        }
+        if (!openLoopRates.empty()) {
+            ss << ", open-loop " << FLAGS_arrival << " arrivals at ";
+            for (size_t i = 0; i < openLoopRates.size(); i++) {
+                ss << (i == 0 ? "" : ", ") << openLoopRates[i];
+            }
+            ss << " QPS";
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << getDurationInMilliseconds(duration_seconds) << " ms duration";
@@ -528,51 +592,39 @@ int main(int argc, char *argv[]) {
                                         });
         inferRequestsQueue.resetTimes();
 
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                THROW_IE_EXCEPTION << "No idle Infer Requests!";
-            }
-
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no additional overhead (and should return immediately).
-                // The primary reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as well,
-                // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
-                // So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->startAsync();
-            }
-            iteration++;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-            if (niter > 0) {
-                progressBar.addProgress(1);
-            } else {
-                // calculate how many progress intervals are covered by current iteration.
-                // depends on the current iteration time and time of each progress interval.
-                // Previously covered progress intervals must be skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
-            }
+        std::vector<OpenLoopResult> openLoopResults;
+        for (auto rate : openLoopRates) {
+            // requests are submitted at the given rate, number of iterations is not aligned by requests number
+            openLoopResults.push_back(runOpenLoop(inferRequestsQueue, rate, FLAGS_arrival == "poisson",
+                                                  duration_nanoseconds, FLAGS_niter));
+            const auto& result = openLoopResults.back();
+            slog::info << "Open-loop " << rate << " QPS: achieved " << double_to_string(result.achievedQps)
+                       << " QPS, p50 " << double_to_string(result.latency.percentile(50))
+                       << " ms, p99 " << double_to_string(result.latency.percentile(99)) << " ms" << slog::endl;
+            progressBar.addProgress(progressBarTotalCount / openLoopRates.size());
         }
 
-        // wait the latest inference executions
-        inferRequestsQueue.waitAll();
+        if (openLoopRates.empty()) {
+            auto result = runClosedLoop(inferRequestsQueue, nireq, duration_nanoseconds, niter, FLAGS_api == "sync",
+                                        [&](uint64_t, uint64_t execTime) {
+                if (niter > 0) {
+                    progressBar.addProgress(1);
+                } else {
+                    // calculate how many progress intervals are covered by current iteration.
+                    // depends on the current iteration time and time of each progress interval.
+                    // Previously covered progress intervals must be skipped.
+                    auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.addProgress(newProgress);
+                    progressCnt += newProgress;
+                }
+            });
+            iteration = result.count;
+        }
 
         double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
@@ -580,21 +632,39 @@ int main(int argc, char *argv[]) {
                      batchSize * 1000.0 * iteration / totalDuration;
 
         if (statistics) {
-            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
-                                      {
-                                              {"total execution time (ms)", double_to_string(totalDuration)},
-                                              {"total number of iterations", std::to_string(iteration)},
-                                      });
-            if (device_name.find("MULTI") == std::string::npos) {
+            // in open-loop mode the totals describe the last rate only, so every rate is reported separately
+            if (openLoopResults.empty()) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {"total execution time (ms)", double_to_string(totalDuration)},
+                                                  {"total number of iterations", std::to_string(iteration)},
+                                          });
+                if (device_name.find("MULTI") == std::string::npos) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {"latency (ms)", double_to_string(latency)},
+                                              });
+                }
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
-                                                  {"latency (ms)", double_to_string(latency)},
+                                                  {"throughput", double_to_string(fps)}
                                           });
+            } else {
+                std::vector<StatisticsReport::OpenLoopPoint> points;
+                for (const auto& result : openLoopResults) {
+                    points.push_back({result.targetQps, result.achievedQps, result.count,
+                                      result.latency.percentile(50), result.latency.percentile(90),
+                                      result.latency.percentile(99), result.latency.percentile(99.9),
+                                      result.latency.max(), result.meanQueueingMs});
+                }
+                statistics->addOpenLoopResults(points);
+                if (openLoopResults.size() > 1) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {"saturation QPS", double_to_string(findSaturationQps(openLoopResults))}
+                                              });
+                }
             }
-            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
-                                      {
-                                              {"throughput", double_to_string(fps)}
-                                      });
         }
 
         progressBar.finish();
@@ -637,11 +707,36 @@ int main(int argc, char *argv[]) {
         if (statistics)
             statistics->dump();
 
-        std::cout << "Count:      " << iteration << " iterations" << std::endl;
-        std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
-            std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
-        std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (openLoopResults.empty()) {
+            std::cout << "Count:      " << iteration << " iterations" << std::endl;
+            std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
+            if (device_name.find("MULTI") == std::string::npos)
+                std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        } else {
+            std::cout << "Open-loop latency (" << FLAGS_arrival << " arrivals):" << std::endl;
+            std::cout << std::setw(12) << "target QPS" << std::setw(14) << "achieved QPS" << std::setw(12) << "p50, ms"
+                      << std::setw(12) << "p90, ms" << std::setw(12) << "p99, ms" << std::setw(12) << "p99.9, ms"
+                      << std::setw(12) << "max, ms" << std::setw(16) << "queueing, ms" << std::endl;
+            for (const auto& result : openLoopResults) {
+                std::cout << std::setw(12) << double_to_string(result.targetQps)
+                          << std::setw(14) << double_to_string(result.achievedQps)
+                          << std::setw(12) << double_to_string(result.latency.percentile(50))
+                          << std::setw(12) << double_to_string(result.latency.percentile(90))
+                          << std::setw(12) << double_to_string(result.latency.percentile(99))
+                          << std::setw(12) << double_to_string(result.latency.percentile(99.9))
+                          << std::setw(12) << double_to_string(result.latency.max())
+                          << std::setw(16) << double_to_string(result.meanQueueingMs) << std::endl;
+            }
+            if (openLoopResults.size() > 1) {
+                auto saturationQps = findSaturationQps(openLoopResults);
+                if (saturationQps > 0.0) {
+                    std::cout << "Saturation: " << double_to_string(saturationQps) << " QPS is the highest sustained rate" << std::endl;
+                } else {
+                    std::cout << "Saturation: none of the request rates is sustained" << std::endl;
+                }
+            }
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
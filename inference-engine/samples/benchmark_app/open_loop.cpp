@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open_loop.hpp"
+
+OpenLoopResult runOpenLoop(InferRequestsQueue& queue, double qps, bool poisson, uint64_t durationNs, uint64_t niter) {
+    if (qps <= 0.0) {
+        throw std::logic_error("Request rate should be positive");
+    }
+    // fixed seed makes arrivals reproducible between runs
+    std::mt19937_64 generator(42);
+    std::exponential_distribution<double> interval(qps);
+
+    queue.resetTimes();
+    const auto startTime = Time::now();
+    double offsetSeconds = 0.0;
+    uint64_t submitted = 0;
+    while (niter == 0 || submitted < niter) {
+        auto scheduledTime = startTime + std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(offsetSeconds));
+        if (durationNs != 0 && static_cast<uint64_t>(std::chrono::duration_cast<ns>(scheduledTime - startTime).count()) >= durationNs) {
+            break;
+        }
+        std::this_thread::sleep_until(scheduledTime);
+        auto inferRequest = queue.getIdleRequest();
+        // rechecks errors of the previous execution of the request
+        inferRequest->wait();
+        inferRequest->startAsync(scheduledTime);
+        submitted++;
+        offsetSeconds += poisson ? interval(generator) : 1.0 / qps;
+    }
+    queue.waitAll();
+
+    OpenLoopResult result;
+    result.targetQps = qps;
+    auto latencies = queue.getLatencies();
+    auto queueingTimes = queue.getQueueingTimes();
+    result.count = latencies.size();
+    result.latency.record(latencies);
+    result.durationMs = queue.getDurationInMilliseconds();
+    if (result.durationMs > 0.0) {
+        result.achievedQps = result.count * 1000.0 / result.durationMs;
+    }
+    if (!queueingTimes.empty()) {
+        result.meanQueueingMs = std::accumulate(queueingTimes.begin(), queueingTimes.end(), 0.0) / queueingTimes.size();
+    }
+    return result;
+}
+
+std::vector<double> parseQpsList(const std::string& qps_string) {
+    std::vector<double> rates;
+    std::stringstream ss(qps_string);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        double rate = 0.0;
+        try {
+            rate = std::stod(item);
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse request rate '" + item + "'");
+        }
+        if (rate <= 0.0) {
+            throw std::logic_error("Request rate should be positive, but " + item + " is given");
+        }
+        rates.push_back(rate);
+    }
+    std::sort(rates.begin(), rates.end());
+    return rates;
+}
+
+double findSaturationQps(const std::vector<OpenLoopResult>& sweep) {
+    // rate is considered sustained while at least 95% of the requested throughput is reached
+    constexpr double sustainedRatio = 0.95;
+    double saturationQps = 0.0;
+    for (const auto& point : sweep) {
+        if (point.achievedQps < sustainedRatio * point.targetQps) {
+            break;
+        }
+        saturationQps = point.targetQps;
+    }
+    return saturationQps;
+}
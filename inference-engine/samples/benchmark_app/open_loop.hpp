@@ -0,0 +1,33 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+#include "latency_histogram.hpp"
+
+/// @brief Results of inference with requests submitted at a given rate regardless of their completion
+struct OpenLoopResult {
+    double targetQps = 0.0;
+    double achievedQps = 0.0;
+    size_t count = 0;
+    double durationMs = 0.0;
+    double meanQueueingMs = 0.0;
+    LatencyHistogram latency;
+};
+
+/// @brief Submits requests with @p qps rate, constant or with exponentially distributed intervals (Poisson arrivals),
+/// until @p durationNs is elapsed or @p niter requests are submitted. Latency of every request is measured from its
+/// scheduled submission time, so it includes waiting for an idle infer request.
+OpenLoopResult runOpenLoop(InferRequestsQueue& queue, double qps, bool poisson, uint64_t durationNs, uint64_t niter);
+
+/// @brief Parses comma-separated list of positive request rates
+std::vector<double> parseQpsList(const std::string& qps_string);
+
+/// @brief Returns the highest rate of the sweep sustained before the achieved throughput fell behind the target one,
+/// 0 if the lowest rate is not sustained
+double findSaturationQps(const std::vector<OpenLoopResult>& sweep);
@@ -17,6 +17,14 @@ void StatisticsReport::addParameters(const Category &category, const Parameters&
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+void StatisticsReport::addOpenLoopResults(const std::vector<OpenLoopPoint>& points) {
+    _openLoopPoints.insert(_openLoopPoints.end(), points.begin(), points.end());
+}
+
+void StatisticsReport::addColocatedResults(const std::vector<ColocatedModelPoint>& points) {
+    _colocatedPoints.insert(_colocatedPoints.end(), points.begin(), points.end());
+}
+
 void StatisticsReport::dump() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
@@ -50,6 +58,36 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (!_openLoopPoints.empty()) {
+        dumper << "Open-loop latency";
+        dumper.endLine();
+
+        dumper << "target QPS" << "achieved QPS" << "count" << "p50 (ms)" << "p90 (ms)" << "p99 (ms)" << "p99.9 (ms)"
+               << "max (ms)" << "mean queueing (ms)";
+        dumper.endLine();
+        for (auto& point : _openLoopPoints) {
+            dumper << point.targetQps << point.achievedQps << point.count << point.p50 << point.p90 << point.p99
+                   << point.p999 << point.max << point.meanQueueing;
+            dumper.endLine();
+        }
+        dumper.endLine();
+    }
+
+    if (!_colocatedPoints.empty()) {
+        dumper << "Co-located models";
+        dumper.endLine();
+
+        dumper << "model" << "nstreams" << "nireq" << "target QPS" << "count" << "throughput" << "p50 (ms)"
+               << "p90 (ms)" << "p99 (ms)" << "max (ms)";
+        dumper.endLine();
+        for (auto& point : _colocatedPoints) {
+            dumper << point.model << point.nstreams << point.nireq << point.targetQps << point.count
+                   << point.throughput << point.p50 << point.p90 << point.p99 << point.max;
+            dumper.endLine();
+        }
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -30,6 +30,33 @@ public:
         std::string report_folder;
     };
 
+    /// @brief latency percentiles measured for one request rate in open-loop mode
+    struct OpenLoopPoint {
+        double targetQps;
+        double achievedQps;
+        size_t count;
+        double p50;
+        double p90;
+        double p99;
+        double p999;
+        double max;
+        double meanQueueing;
+    };
+
+    /// @brief throughput and latency of one model executed concurrently with other models
+    struct ColocatedModelPoint {
+        std::string model;
+        std::string nstreams;
+        size_t nireq;
+        double targetQps;
+        size_t count;
+        double throughput;
+        double p50;
+        double p90;
+        double p99;
+        double max;
+    };
+
     enum class Category {
         COMMAND_LINE_PARAMETERS,
         RUNTIME_CONFIG,
@@ -53,6 +80,10 @@ public:
 
     void addParameters(const Category &category, const Parameters& parameters);
 
+    void addOpenLoopResults(const std::vector<OpenLoopPoint>& points);
+
+    void addColocatedResults(const std::vector<ColocatedModelPoint>& points);
+
     void dump();
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
@@ -67,6 +98,12 @@ private:
     // parameters
     std::map<Category, Parameters> _parameters;
 
+    // open-loop latencies per request rate
+    std::vector<OpenLoopPoint> _openLoopPoints;
+
+    // results per co-located model
+    std::vector<ColocatedModelPoint> _colocatedPoints;
+
     // csv separator
     std::string _separator;
 };
@@ -4,6 +4,9 @@
 
 #include <string>
 #include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
 #include <utility>
 #include <vector>
 #include <map>
@@ -173,6 +176,57 @@ std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& sha
     return ss.str();
 }
 
+std::string double_to_string(const double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+OpenLoopResult runClosedLoop(InferRequestsQueue& queue, size_t nireq, uint64_t durationNs, uint64_t niter,
+                             bool sync, const std::function<void(uint64_t, uint64_t)>& onIteration) {
+    queue.resetTimes();
+    const auto startTime = Time::now();
+    uint64_t execTime = 0;
+    uint64_t iteration = 0;
+    while ((niter != 0 && iteration < niter) ||
+           (durationNs != 0 && execTime < durationNs) ||
+           (!sync && iteration % nireq != 0)) {
+        auto inferRequest = queue.getIdleRequest();
+        if (!inferRequest) {
+            THROW_IE_EXCEPTION << "No idle Infer Requests!";
+        }
+
+        if (sync) {
+            inferRequest->infer();
+        } else {
+            // As the inference request is currently idle, the wait() adds no additional overhead (and should return immediately).
+            // The primary reason for calling the method is exception checking/re-throwing.
+            // Callback, that governs the actual execution can handle errors as well,
+            // but as it uses just error codes it has no details like 'what()' method of `std::exception`
+            // So, rechecking for any exceptions here.
+            inferRequest->wait();
+            inferRequest->startAsync();
+        }
+        iteration++;
+        execTime = static_cast<uint64_t>(std::chrono::duration_cast<ns>(Time::now() - startTime).count());
+        if (onIteration) {
+            onIteration(iteration, execTime);
+        }
+    }
+    // wait the latest inference executions
+    queue.waitAll();
+
+    OpenLoopResult result;
+    auto latencies = queue.getLatencies();
+    result.count = latencies.size();
+    result.latency.record(latencies);
+    result.durationMs = queue.getDurationInMilliseconds();
+    if (result.durationMs > 0.0) {
+        result.achievedQps = result.count * 1000.0 / result.durationMs;
+    }
+    return result;
+}
+
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename,
                  const std::map<std::string, std::map<std::string, std::string>>& config) {
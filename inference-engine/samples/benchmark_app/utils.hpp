@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <map>
 
+#include "open_loop.hpp"
+
 std::vector<std::string> parseDevices(const std::string& device_string);
 uint32_t deviceDefaultDeviceDurationInSeconds(const std::string& device);
 std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector<std::string>& devices,
@@ -17,6 +20,14 @@ bool updateShapes(InferenceEngine::ICNNNetwork::InputShapes& shapes,
 bool adjustShapesBatch(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                        const size_t batch_size, const InferenceEngine::InputsDataMap& input_info);
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
+std::string double_to_string(const double number);
+
+/// @brief Keeps all infer requests of @p queue busy until @p durationNs is elapsed or @p niter requests are done,
+/// in async mode the number of requests is aligned to @p nireq. @p onIteration is called after every started request
+/// with the number of started requests and elapsed time in nanoseconds.
+OpenLoopResult runClosedLoop(InferRequestsQueue& queue, size_t nireq, uint64_t durationNs, uint64_t niter,
+                             bool sync = false,
+                             const std::function<void(uint64_t, uint64_t)>& onIteration = {});
 
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename,
@@ -512,6 +512,7 @@ void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
                 // Stores the given blob as ROI blob. It will be used to fill in network input
                 // during pre-processing
                 _preProcData[name] = CreatePreprocDataHelper();
+                _preProcData[name]->setCacheOwner(_exeNetwork.get());
                 _preProcData[name]->isApplicable(data, _inputs[name]);
                 _preProcData[name]->setRoiBlob(data);
             } else {
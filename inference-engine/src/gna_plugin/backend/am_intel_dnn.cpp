@@ -372,17 +372,21 @@ void GNAPluginNS::backend::AMIntelDNN::InitDeinterleaveComponentPrivate(intel_dn
 }
 
 void GNAPluginNS::backend::AMIntelDNN::Propagate() {
-    for (uint32_t i = 0; i < component.size(); i++) {
-        intel_dnn_component_t *comp = &component[i];
+    Propagate(component);
+}
+
+void GNAPluginNS::backend::AMIntelDNN::Propagate(std::vector<intel_dnn_component_t> &components) {
+    for (uint32_t i = 0; i < components.size(); i++) {
+        intel_dnn_component_t *comp = &components[i];
         uint32_t *ptr_active_outputs = nullptr;
         uint32_t num_active_outputs = (comp->orientation_out == kDnnInterleavedOrientation)
                                       ? comp->num_rows_out : comp->num_columns_out;
 
-        if (i == component.size() - 1) {  // active list applies to last component
+        if (i == components.size() - 1) {  // active list applies to last component
             ptr_active_outputs = ptr_active_outputs_;
             num_active_outputs = num_active_outputs_;
-        } else if (i == component.size() - 2) {  // also applies to last two components when last is PWL
-            if ((component[i].operation == kDnnAffineOp) && (component[i + 1].operation == kDnnPiecewiselinearOp)) {
+        } else if (i == components.size() - 2) {  // also applies to last two components when last is PWL
+            if ((components[i].operation == kDnnAffineOp) && (components[i + 1].operation == kDnnPiecewiselinearOp)) {
                 ptr_active_outputs = ptr_active_outputs_;
                 num_active_outputs = num_active_outputs_;
             }
@@ -394,8 +398,8 @@ void GNAPluginNS::backend::AMIntelDNN::Propagate() {
             case kDnnDiagonalOp:ApplyDiagonalTransform(comp);
                 break;
             case kDnnRecurrentOp:
-                if ((i < component.size() - 1) && (component[i + 1].operation == kDnnPiecewiselinearOp)) {
-                    intel_dnn_component_t *comp_pwl = &component[i + 1];
+                if ((i < components.size() - 1) && (components[i + 1].operation == kDnnPiecewiselinearOp)) {
+                    intel_dnn_component_t *comp_pwl = &components[i + 1];
                     for (uint32_t j = 0; j < comp->num_rows_in; j++) {
                         void *ptr_feedbacks =
                                 reinterpret_cast<void *>(reinterpret_cast<int32_t *>(comp->op.recurrent.ptr_feedbacks) + j * comp_pwl->num_columns_out);
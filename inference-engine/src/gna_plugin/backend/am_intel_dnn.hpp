@@ -267,6 +267,11 @@ public:
 
     void Propagate();
 
+    /**
+     * @brief Propagates copy of components which may work with another set of intermediate buffers
+     */
+    void Propagate(std::vector<intel_dnn_component_t> &components);
+
     float OutputScaleFactor(uint32_t component_index) {
         return OutputScaleFactor(component[component_index]);
     }
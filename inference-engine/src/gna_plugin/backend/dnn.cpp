@@ -25,6 +25,9 @@
 #include "gna_plugin_log.hpp"
 #include "runtime/pwl.h"
 #include "runtime/cnn.h"
+#include "runtime/parallel.hpp"
+
+using GNAPluginNS::runtime::ParallelRanges;
 
 
 void GNAPluginNS::backend::ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *list, uint32_t listsize) {
@@ -170,11 +173,13 @@ void GNAPluginNS::backend::ApplyTranspose(intel_dnn_component_t *component) {
     // B = Transpose(A) where A is mxn and B is nxm
     auto A = reinterpret_cast<float *>(component->ptr_inputs);
     auto B = reinterpret_cast<float *>(component->ptr_outputs);
-    for (uint32_t row = 0; row < m; row++) {
-        for (uint32_t col = 0; col < n; col++) {
-            B[col * ldb + row] = A[row * lda + col];
+    ParallelRanges(m, n, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t row = begin; row < end; row++) {
+            for (uint32_t col = 0; col < n; col++) {
+                B[col * ldb + row] = A[row * lda + col];
+            }
         }
-    }
+    });
 }
 
 void GNAPluginNS::backend::ApplyCopy(intel_dnn_component_t *component) {
@@ -193,11 +198,13 @@ void GNAPluginNS::backend::ApplyCopy(intel_dnn_component_t *component) {
     }
     auto A = reinterpret_cast<float *>(src);
     auto B = reinterpret_cast<float *>(dst);
-    for (uint32_t row = 0; row < m; row++) {
-        for (uint32_t col = 0; col < n; col++) {
-            B[row * ldb + col] = A[row * lda + col];
+    ParallelRanges(m, n, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t row = begin; row < end; row++) {
+            for (uint32_t col = 0; col < n; col++) {
+                B[row * ldb + col] = A[row * lda + col];
+            }
         }
-    }
+    });
 }
 
 bool GNAPluginNS::backend::isCompatibleDnn(GNAPluginNS::backend::AMIntelDNN dnn1, GNAPluginNS::backend::AMIntelDNN dnn2) {
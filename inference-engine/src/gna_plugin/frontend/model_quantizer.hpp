@@ -7,13 +7,17 @@
 #include <vector>
 #include <utility>
 #include <string>
+#include <chrono>
+#include <exception>
 
+#include <ie_parallel.hpp>
 #include "layer_transform.hpp"
 #include "gna_graph_tools.hpp"
 #include "details/ie_cnn_network_tools.h"
 #include "layer_quantizer.hpp"
 #include "scale_factor_calc.hpp"
 #include "weights_converter.hpp"
+#include "gna_itt.hpp"
 
 namespace GNAPluginNS {
 
@@ -39,9 +43,10 @@ class ModelQuantizer {
 
     template <class PreQuantisationCb>
     InferenceEngine::ICNNNetwork::Ptr quantize(InferenceEngine::ICNNNetwork &model, const PreQuantisationCb &cb, std::vector<float> scaleFactor) const {
+        std::vector<InferenceEngine::CNNLayerPtr> newLayers;
         auto visitor = [&](InferenceEngine::CNNLayerPtr lp) {
             auto newLayer = InferenceEngine::injectData<QuantizedLayerParams>(lp);
-            transformLayer(newLayer, WeightsConverter());
+            newLayers.push_back(newLayer);
             return newLayer;
         };
         auto copiedNet = InferenceEngine::CNNNetCopy(model);
@@ -50,6 +55,25 @@ class ModelQuantizer {
         IE_ASSERT(copiedNet.get() != nullptr);
         copiedNet = InferenceEngine::CNNNetCopy(*copiedNet, visitor);
 
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "ModelQuantizer::ConvertWeights");
+            PhaseTimer timer("weights conversion");
+            // every layer converts only its own blobs and output data, first error is rethrown in calling thread
+            std::vector<std::exception_ptr> errors(newLayers.size());
+            InferenceEngine::parallel_for(newLayers.size(), [&](size_t i) {
+                try {
+                    transformLayer(newLayers[i], WeightsConverter());
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+            for (auto &&error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
         // TODO: probably not the best way of using dynamic cast in order to transform Precision
         // one of solution is to create not copyNet overloads, that accepts 2 functors, one for layer copy
         // and another one for net copy
@@ -84,17 +108,41 @@ class ModelQuantizer {
             scaleIndex++;
         }
 
-        propagateScaleFactor(sortedNewNet, T::mandatory().getWeightsPrecision().size());
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "ModelQuantizer::PropagateScaleFactors");
+            PhaseTimer timer("scale factors propagation");
+            propagateScaleFactor(sortedNewNet, T::mandatory().getWeightsPrecision().size());
+        }
 
-        // sorted order gives possibility for propagate quantisation along depended layers
-        for (auto &&layer : sortedNewNet) {
-            transformLayer(layer, lc);
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "ModelQuantizer::QuantizeLayers");
+            PhaseTimer timer("layers quantization");
+            // sorted order gives possibility for propagate quantisation along depended layers,
+            // rows of weights are quantized in parallel within a layer
+            for (auto &&layer : sortedNewNet) {
+                transformLayer(layer, lc);
+            }
         }
 
         return copiedNet;
     }
 
  private :
+    /**
+     * @brief reports duration of a quantization phase into gna log
+     */
+    class PhaseTimer {
+        const char *name;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+     public:
+        explicit PhaseTimer(const char *name) : name(name) {}
+        ~PhaseTimer() {
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            gnalog() << "[GNA quantization] " << name << ": " << elapsed.count() / 1000.0 << " ms" << std::endl;
+        }
+    };
+
     void propagateScaleFactor(std::vector<InferenceEngine::CNNLayerPtr> & net, int weightsBytesSize) const {
         ScaleFactorCalculator sf(net, weightsBytesSize);
 
@@ -107,6 +155,8 @@ class ModelQuantizer {
                 }
             }
         }
+        gnalog() << "[GNA quantization] scale factors of " << net.size() << " layers computed with "
+                 << sf.getVisitsCount() << " layer visits and " << sf.getRestartsCount() << " restarts" << std::endl;
     }
 };
 }  // namespace GNAPluginNS
@@ -4,8 +4,38 @@
 
 #include <cstring>
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <vector>
 #include <details/ie_exception.hpp>
 #include "quantization.h"
+#include "runtime/parallel.hpp"
+
+namespace {
+
+/**
+ * @brief maximum absolute value of a row major matrix, rows are processed in parallel
+ */
+float MaxAbsWeight(const float *ptr_float_weights, uint32_t num_rows, uint32_t num_columns) {
+    std::vector<float> row_max(num_rows, -1e20f);
+    GNAPluginNS::runtime::ParallelRanges(num_rows, num_columns, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            for (uint32_t j = 0; j < num_columns; j++) {
+                float weight = ptr_float_weights[i * num_columns + j];
+                if (fabs(weight) > row_max[i]) {
+                    row_max[i] = fabs(weight);
+                }
+            }
+        }
+    });
+    float max_weight = -1e20f;
+    for (auto value : row_max) {
+        max_weight = std::max(max_weight, value);
+    }
+    return max_weight;
+}
+
+}  // namespace
 
 void QuantizeAffine16(float *ptr_float_weights,
                       float *ptr_float_biases,
@@ -22,27 +52,7 @@ void QuantizeAffine16(float *ptr_float_weights,
 
     if (*ptr_weight_scale_factor == 1.0) {
         // scale factor for weights is not calculated yet
-        float mean_weight = 0.0;
-        float mean_weight_squared = 0.0;
-        float max_weight = -1e20f;
-        float var_weight;
-        float mean_plus_2stdev;
-
-        for (uint32_t i = 0; i < num_rows; i++) {
-            for (uint32_t j = 0; j < num_columns; j++) {
-                float weight = ptr_float_weights[i * num_columns + j];
-                mean_weight += weight;
-                mean_weight_squared += weight * weight;
-                if (fabs(weight) > max_weight) {
-                    max_weight = fabs(weight);
-                }
-            }
-        }
-
-        mean_weight /= static_cast<float>(num_rows * num_columns);
-        mean_weight_squared /= static_cast<float>(num_rows * num_columns);
-        var_weight = mean_weight_squared - mean_weight * mean_weight;
-        mean_plus_2stdev = mean_weight + 2.0f * static_cast<float>(sqrtf(var_weight));
+        float max_weight = MaxAbsWeight(ptr_float_weights, num_rows, num_columns);
 
         if (max_weight != 0.0f) {
             *ptr_weight_scale_factor = static_cast<float>(MAX_VAL_2B_WEIGHT) / max_weight;
@@ -50,26 +60,33 @@ void QuantizeAffine16(float *ptr_float_weights,
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
 
-    for (uint32_t row = 0; row < num_rows; row++) {
-        for (uint32_t col = 0; col < num_columns; col++) {
-            float rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
-            float value = ptr_float_weights[row * num_columns + col] * *ptr_weight_scale_factor + rounding_value;
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            if (value > 32767.0) {
-                *ptr_weight_16 = 32767;
-                num_saturate++;
-            } else if (value < -32768.0) {
-                *ptr_weight_16 = -32768;
-                num_saturate++;
-            } else {
-                *ptr_weight_16 = (int16_t) value;
+    const float weight_scale_factor = *ptr_weight_scale_factor;
+    std::atomic<uint32_t> num_saturate_weights{0};
+    GNAPluginNS::runtime::ParallelRanges(num_rows, num_columns_padded, [&](uint32_t begin, uint32_t end) {
+        uint32_t chunk_saturate = 0;
+        for (uint32_t row = begin; row < end; row++) {
+            for (uint32_t col = 0; col < num_columns; col++) {
+                float rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
+                float value = ptr_float_weights[row * num_columns + col] * weight_scale_factor + rounding_value;
+                int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
+                if (value > 32767.0) {
+                    *ptr_weight_16 = 32767;
+                    chunk_saturate++;
+                } else if (value < -32768.0) {
+                    *ptr_weight_16 = -32768;
+                    chunk_saturate++;
+                } else {
+                    *ptr_weight_16 = (int16_t) value;
+                }
+            }
+            for (uint32_t col = num_columns; col < num_columns_padded; col++) {
+                int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
+                *ptr_weight_16 = 0;
             }
         }
-        for (uint32_t col = num_columns; col < num_columns_padded; col++) {
-            int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
-            *ptr_weight_16 = 0;
-        }
-    }
+        num_saturate_weights += chunk_saturate;
+    });
+    num_saturate += num_saturate_weights;
     for (uint32_t row = num_rows; row < num_rows_padded; row++) {
         for (uint32_t col = 0; col < num_columns_padded; col++) {
             int16_t *ptr_weight_16 = ptr_int_weights + (row * num_columns_padded + col);
@@ -109,10 +126,20 @@ float ScaleFactorForQuantization(void *ptr_float_memory, float target_max, size_
     float max = 0.0;
     float scale_factor;
 
-    for (size_t i = 0; i < num_elements; i++) {
-        if (fabs(ptr_float_feat[i]) > max) {
-            max = fabs(ptr_float_feat[i]);
+    // maximum is searched over blocks of elements in parallel
+    const size_t block_size = 4096;
+    std::vector<float> block_max((num_elements + block_size - 1) / block_size, 0.0f);
+    GNAPluginNS::runtime::ParallelRanges(static_cast<uint32_t>(block_max.size()), block_size, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t block = begin; block < end; block++) {
+            for (size_t i = block * block_size; i < std::min(num_elements, (block + 1) * block_size); i++) {
+                if (fabs(ptr_float_feat[i]) > block_max[block]) {
+                    block_max[block] = fabs(ptr_float_feat[i]);
+                }
+            }
         }
+    });
+    for (auto value : block_max) {
+        max = std::max(max, value);
     }
 
     if (max == 0) {
@@ -160,27 +187,7 @@ void QuantizeAffine8(float *ptr_float_weights, float *ptr_float_biases,
 
     if (*ptr_weight_scale_factor == 1.0) {
         // scale factor for weights is not calculated yet
-        float mean_weight = 0.0;
-        float mean_weight_squared = 0.0;
-        float max_weight = -1e20f;
-        float var_weight;
-        float mean_plus_2stdev;
-
-        for (uint32_t i = 0; i < num_rows; i++) {
-            for (uint32_t j = 0; j < num_columns; j++) {
-                float weight = ptr_float_weights[i*num_columns + j];
-                mean_weight += weight;
-                mean_weight_squared += weight * weight;
-                if (fabs(weight) > max_weight) {
-                    max_weight = fabs(weight);
-                }
-            }
-        }
-
-        mean_weight /= static_cast<float>(num_rows * num_columns);
-        mean_weight_squared /= static_cast<float>(num_rows * num_columns);
-        var_weight = mean_weight_squared - mean_weight * mean_weight;
-        mean_plus_2stdev = mean_weight + 2.0f * static_cast<float>(sqrtf(var_weight));
+        float max_weight = MaxAbsWeight(ptr_float_weights, num_rows, num_columns);
 
         *ptr_weight_scale_factor = static_cast<float>(MAX_VAL_1B_WEIGHT) / max_weight;
 
@@ -192,41 +199,46 @@ void QuantizeAffine8(float *ptr_float_weights, float *ptr_float_biases,
         *ptr_weight_scale_factor = MAX_OUT_MULTIPLIER * *ptr_weight_scale_factor;  //  increase dynamic range by max multiplier
         *ptr_output_scale_factor = input_scale_factor * *ptr_weight_scale_factor;
     }
-    float valueAcc = 0.0;
-    for (uint32_t row = 0; row < num_rows; row++) {
-        float scaled_row_max = 0;
-        float rounding_value, value;
-        for (uint32_t col = 0; col < num_columns; col++) {
-            value = ptr_float_weights[row*num_columns + col] * *ptr_weight_scale_factor;
-            valueAcc += value;
-            if (fabs(value) > scaled_row_max) {
-                scaled_row_max = fabs(value);
+    const float weight_scale_factor = *ptr_weight_scale_factor;
+    std::atomic<uint32_t> num_saturate_weights{0};
+    GNAPluginNS::runtime::ParallelRanges(num_rows, 2 * num_columns_padded, [&](uint32_t begin, uint32_t end) {
+        uint32_t chunk_saturate = 0;
+        for (uint32_t row = begin; row < end; row++) {
+            float scaled_row_max = 0;
+            float rounding_value, value;
+            for (uint32_t col = 0; col < num_columns; col++) {
+                value = ptr_float_weights[row*num_columns + col] * weight_scale_factor;
+                if (fabs(value) > scaled_row_max) {
+                    scaled_row_max = fabs(value);
+                }
             }
-        }
 
-        value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
-        ptr_int_biases[row].multiplier = (uint8_t) (value + 0.5);
-        for (uint32_t col = 0; col < num_columns; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
-            rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
+            value = scaled_row_max / static_cast<float>(MAX_VAL_1B_WEIGHT);
+            ptr_int_biases[row].multiplier = (uint8_t) (value + 0.5);
+            for (uint32_t col = 0; col < num_columns; col++) {
+                int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
+                rounding_value = (ptr_float_weights[row * num_columns + col] > 0) ? 0.5f : -0.5f;
 
 
-            value = ptr_float_weights[row * num_columns + col] * (*ptr_weight_scale_factor / ptr_int_biases[row].multiplier) + rounding_value;
-            if (value > 127.0) {
-                *ptr_weight_8 = 127;
-                num_saturate++;
-            } else if (value < -128.0) {
-                *ptr_weight_8 = -128;
-                num_saturate++;
-            } else {
-                *ptr_weight_8 = (int8_t) value;
+                value = ptr_float_weights[row * num_columns + col] * (weight_scale_factor / ptr_int_biases[row].multiplier) + rounding_value;
+                if (value > 127.0) {
+                    *ptr_weight_8 = 127;
+                    chunk_saturate++;
+                } else if (value < -128.0) {
+                    *ptr_weight_8 = -128;
+                    chunk_saturate++;
+                } else {
+                    *ptr_weight_8 = (int8_t) value;
+                }
+            }
+            for (uint32_t col = num_columns; col < num_columns_padded; col++) {
+                int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
+                *ptr_weight_8 = 0;
             }
         }
-        for (uint32_t col = num_columns; col < num_columns_padded; col++) {
-            int8_t *ptr_weight_8 = ptr_int_weights + (row * num_columns_padded + col);
-            *ptr_weight_8 = 0;
-        }
-    }
+        num_saturate_weights += chunk_saturate;
+    });
+    num_saturate += num_saturate_weights;
     for (uint32_t row = num_rows; row < num_rows_padded; row++) {
         for (uint32_t col = 0; col < num_columns_padded; col++) {
             int8_t *ptr_weight_8 = ptr_int_weights + (row*num_columns_padded + col);
@@ -10,6 +10,7 @@
 #include <limits>
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include <ie_layers.h>
 #include "gna_upstream_iterator.hpp"
@@ -622,50 +623,122 @@ class ScaleFactorPerLayer<InferenceEngine::ConvolutionLayer*> : public ScaleFact
 
 /**
  * @brief scale factor calculator will calculate only output scale factors for the layer
- * if scale factor propagation not possible, it will fall indicate a restart condition
+ * if scale factor propagation not possible, it will fall indicate a restart condition.
+ * After a restart only layers reachable from the requantized layer and the layer which requested the restart
+ * are visited again, scale factors of the rest of already processed layers cannot change
  */
 class ScaleFactorCalculator {
     using Cnt = std::vector<InferenceEngine::CNNLayerPtr>;
     Cnt  net;
-    mutable Cnt::const_iterator idx;
+    // position of every layer in topologically sorted net and positions of its consumers
+    std::unordered_map<InferenceEngine::CNNLayer *, size_t> positions;
+    std::vector<std::vector<size_t>> consumers;
+    // next layer to visit
+    mutable size_t idx = 0;
+    // layers before this position were processed at least once
+    mutable size_t processed = 0;
+    // already processed layers which inputs scale factors were changed since
+    mutable std::vector<bool> dirty;
     mutable bool needRestart = false;
+    mutable size_t restarts = 0;
+    mutable size_t visits = 0;
     int weightsBytesSize;
 
+    void markDownstream(size_t from) const {
+        std::vector<size_t> stack = {from};
+        while (!stack.empty()) {
+            auto pos = stack.back();
+            stack.pop_back();
+            for (auto consumer : consumers[pos]) {
+                if (consumer < processed && !dirty[consumer]) {
+                    dirty[consumer] = true;
+                    stack.push_back(consumer);
+                }
+            }
+        }
+    }
+
  public:
     ScaleFactorCalculator(Cnt &net, int weightsBytesSize)
-            : net(net), weightsBytesSize(weightsBytesSize) {
-        idx = std::begin(this->net);
+            : net(net), consumers(net.size()), dirty(net.size(), false), weightsBytesSize(weightsBytesSize) {
+        for (size_t i = 0; i != this->net.size(); i++) {
+            positions[this->net[i].get()] = i;
+        }
+        for (size_t i = 0; i != this->net.size(); i++) {
+            for (auto &&outData : this->net[i]->outData) {
+                for (auto &&inputTo : InferenceEngine::getInputTo(outData)) {
+                    auto consumer = positions.find(inputTo.second.get());
+                    if (consumer != positions.end()) {
+                        consumers[i].push_back(consumer->second);
+                    }
+                }
+            }
+        }
     }
     bool needToRestart() const {
         return needRestart;
     }
     bool allLayersProcessed() const {
-        return idx == std::end(net);
+        for (size_t i = idx; i != net.size(); i++) {
+            if (i >= processed || dirty[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    /**
+     * @brief number of restarts and layers visits done so far, used for diagnostic purposes
+     */
+    size_t getRestartsCount() const {
+        return restarts;
+    }
+    size_t getVisitsCount() const {
+        return visits;
     }
     std::vector<InferenceEngine::CNNLayerPtr> getStartLayers() const {
-        return std::vector<InferenceEngine::CNNLayerPtr>(idx, std::end(net));
+        std::vector<InferenceEngine::CNNLayerPtr> layers;
+        for (size_t i = idx; i != net.size(); i++) {
+            if (i >= processed || dirty[i]) {
+                layers.push_back(net[i]);
+            }
+        }
+        return layers;
     }
     template<class T>
     bool operator()(T ptr) const {
         needRestart = false;
+        visits++;
         frontend::ScaleFactorUpdateResult result;
         if (!frontend::ScaleFactorPerLayer<T>()(ptr, weightsBytesSize, result)) {
             return false;
         }
+        auto current = positions.find(static_cast<InferenceEngine::CNNLayer *>(ptr));
+        if (current == positions.end()) {
+            THROW_GNA_EXCEPTION << "layer " << ptr->name << " not found in sorted network";
+        }
         if (result) {
-            idx++;
+            dirty[current->second] = false;
+            processed = std::max(processed, current->second + 1);
+            idx = current->second + 1;
             return true;
         }
 
-        idx = std::find_if(net.begin(), net.end(), [&](InferenceEngine::CNNLayerPtr cnnLayer) {
-            if (!result) {
-                return result.restartLayer == cnnLayer.get();
-            }
-            return ptr == cnnLayer.get();
-        });
-        if (idx != net.end()) {
-            idx++;
+        auto restart = positions.find(result.restartLayer);
+        if (restart == positions.end()) {
+            THROW_GNA_EXCEPTION << "cannot restart scale factors propagation from " << result.restartLayer->name
+                                << " requested by " << ptr->name;
+        }
+        gnalog() << "Restarting scale factors propagation from " << restart->first->name
+                 << " requested by " << ptr->name << "\n";
+
+        // layer which requested the restart is not processed until its inputs are updated
+        processed = std::max(processed, current->second);
+        if (current->second < processed) {
+            dirty[current->second] = true;
         }
+        markDownstream(restart->second);
+        idx = restart->second + 1;
+        restarts++;
         needRestart = true;
         return true;
     }
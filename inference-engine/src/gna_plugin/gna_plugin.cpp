@@ -644,11 +644,15 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
 #if GNA_LIB_VER == 2
         gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
-        // this can be improved by just copy all structures, but we are too lazy
-        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            // this can be improved by just copy all structures, but we are too lazy
+            dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj);
+        }
 #else
         nnets.emplace_back(make_shared<CPPWrapper<intel_nnet_type_t>>(), -1, InferenceEngine::BlobMap());
-        dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        if (!gnaFlags->sw_fp32) {
+            dnn->InitGNAStruct(&std::get<0>(nnets.back())->obj);
+        }
 #endif
         // relocate rw pointers to new offset
         auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
@@ -671,6 +675,42 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
             relocate(outputsDesc[j].ptrs[i], outputsDesc[j].ptrs[0]);
         }
 
+        if (gnaFlags->sw_fp32) {
+            // software emulation propagates own copy of components where pointers to RW segment are relocated,
+            // content of RW segment is copied since it may contain initialized data
+            ie_memcpy(basePtr, rwSegmentSize, gnamem->getBasePtr(), rwSegmentSize);
+            auto relocateRW = [&](void *& ptr) {
+                auto offset = reinterpret_cast<uint8_t *>(ptr) - reinterpret_cast<uint8_t *>(gnamem->getBasePtr());
+                if (ptr != nullptr && offset >= 0 && static_cast<size_t>(offset) < rwSegmentSize) {
+                    ptr = basePtr + offset;
+                }
+            };
+            swParallelComponents.push_back(dnn->component);
+            for (auto &comp : swParallelComponents.back()) {
+                relocateRW(comp.ptr_inputs);
+                relocateRW(comp.ptr_outputs);
+                switch (comp.operation) {
+                    case kDnnAffineOp:
+                    case kDnnDiagonalOp:
+                        relocateRW(comp.op.affine.ptr_weights);
+                        relocateRW(comp.op.affine.ptr_biases);
+                        break;
+                    case kDnnRecurrentOp:
+                        relocateRW(comp.op.recurrent.ptr_weights);
+                        relocateRW(comp.op.recurrent.ptr_biases);
+                        relocateRW(comp.op.recurrent.ptr_feedbacks);
+                        break;
+                    case kDnnConvolutional1dOp:
+                        relocateRW(comp.op.conv1D.ptr_filters);
+                        relocateRW(comp.op.conv1D.ptr_biases);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            continue;
+        }
+
 #if GNA_LIB_VER == 2
         for (int j = 0; j != std::get<0>(gnaModels.front())->obj.NumberOfOperations; j++) {
             auto & gnaOperation = std::get<0>(gnaModels[i])->obj.Operations[j];
@@ -686,6 +726,10 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
         }
     }
 
+    if (gnaFlags->sw_fp32) {
+        swPropagations.resize(gnaFlags->gna_lib_async_threads_num);
+    }
+
     // calculating input orientation without memory layers, since their orientation not changed during infer right now
     std::unordered_map<string, string> skippedLayers;
 
@@ -757,7 +801,9 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
 #if GNA_LIB_VER == 2
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice) {
-        gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        for (size_t i = 0; i < gnaModels.size(); i++) {
+            gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        }
         return;
     }
     for (auto& model : gnaModels) {
@@ -937,7 +983,15 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
 
     if (!gnadevice) {
-        dnn->Propagate();
+        if (gnaFlags->gna_lib_async_threads_num > 1) {
+            // parallel requests are emulated in background, so several of them can be computed at the same time
+            auto &components = idx == 0 ? dnn->component : swParallelComponents[idx - 1];
+            swPropagations[idx] = std::async(std::launch::async, [this, &components] {
+                dnn->Propagate(components);
+            });
+        } else {
+            dnn->Propagate();
+        }
         if (freeNnet != nnets.end()) {
             std::get<1>(*freeNnet) = 1;
         }
@@ -977,6 +1031,15 @@ void GNAPlugin::Wait(uint32_t request_idx) {
 
     if (gnadevice) {
         gnadevice->wait(std::get<1>(nnets[request_idx]));
+    } else if (request_idx < swPropagations.size() && swPropagations[request_idx].valid()) {
+        // the slot is released below only after the propagation has finished
+        try {
+            swPropagations[request_idx].get();
+        } catch (...) {
+            // a failed propagation still frees its slot, otherwise the request stays busy forever
+            std::get<1>(nnets[request_idx]) = -1;
+            throw;
+        }
     }
 
     std::get<1>(nnets[request_idx]) = -1;
@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 #include <tuple>
+#include <future>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include "cpp_interfaces/impl/ie_memory_state_internal.hpp"
 #include "descriptions/gna_flags.hpp"
@@ -52,6 +53,13 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     std::vector<std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>> gnaRequestConfigToRequestIdMap;
 #endif
 
+    /**
+     * @brief - software emulation: components of parallel infer requests working with own intermediate buffers
+     * and propagations running in background
+     */
+    std::vector<std::vector<intel_dnn_component_t>> swParallelComponents;
+    std::vector<std::future<void>> swPropagations;
+
 #if GNA_LIB_VER == 2
     uint32_t activeLayerIndex = 0xffffffff;
 #endif
@@ -8,8 +8,12 @@
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath.h"
+#include "parallel.hpp"
 #include "backend/dnn_types.h"
 
+using GNAPluginNS::runtime::ParallelRanges;
+
 
 void CNNFilter32(intel_dnn_component_t *component) {
     float *ptr_filters = reinterpret_cast<float *>(component->op.conv1D.ptr_filters);
@@ -26,17 +30,17 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad problem dimensions in CNNFilter32!";
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
+    uint32_t num_filters = component->op.conv1D.num_filters;
+    ParallelRanges(num_filter_outputs, static_cast<uint64_t>(num_filters) * num_filter_coefficients,
+                   [&](uint32_t begin, uint32_t end) {
+        for (uint32_t j = begin; j < end; j++) {
+            float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+            for (uint32_t i = 0; i < num_filters; i++) {
+                float *ptr_coef = ptr_filters + i * num_filter_coefficients;
+                ptr_outputs[j * num_filters + i] = ptr_biases[i] + sdot_unrolled(num_filter_coefficients, ptr_in, ptr_coef);
             }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
         }
-    }
+    });
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -96,29 +100,37 @@ void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number
         uint32_t num_pool_step = component->op.maxpool.num_inputs_step;
         uint32_t num_rows_in = num_inputs / component->op.maxpool.num_inputs_stride;
 
-        for (uint32_t i = 0; i < num_columns; i++) {
-            int32_t m = 0;
-            if (component->op.maxpool.do_sum_not_max) {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float sum = 0.0;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
+        uint32_t num_pools = (num_rows_in + num_pool_step - 1) / num_pool_step;
+
+        // Pools are independent and every pool is processed row by row, so the innermost loop
+        // goes over contiguous columns
+        ParallelRanges(num_pools, static_cast<uint64_t>(num_pool_size) * num_columns, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t m = begin; m < end; m++) {
+                uint32_t j = m * num_pool_step;
+                uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
+                float *ptr_out = ptr_outputs + m * num_columns;
+                if (component->op.maxpool.do_sum_not_max) {
+                    for (uint32_t i = 0; i < num_columns; i++) {
+                        ptr_out[i] = 0.0f;
+                    }
                     for (uint32_t k = j; k < num_end; k++) {
-                        sum += ptr_inputs[k * num_columns + i];
+                        const float *ptr_in = ptr_inputs + k * num_columns;
+                        for (uint32_t i = 0; i < num_columns; i++) {
+                            ptr_out[i] += ptr_in[i];
+                        }
+                    }
+                } else {
+                    for (uint32_t i = 0; i < num_columns; i++) {
+                        ptr_out[i] = -1e20f;
                     }
-                    ptr_outputs[m * num_columns + i] = sum;
-                    m++;
-                }
-            } else {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float max = -1e20f;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
                     for (uint32_t k = j; k < num_end; k++) {
-                        if (ptr_inputs[k * num_columns + i] > max) max = ptr_inputs[k * num_columns + i];
+                        const float *ptr_in = ptr_inputs + k * num_columns;
+                        for (uint32_t i = 0; i < num_columns; i++) {
+                            ptr_out[i] = (ptr_in[i] > ptr_out[i]) ? ptr_in[i] : ptr_out[i];
+                        }
                     }
-                    ptr_outputs[m * num_columns + i] = max;
-                    m++;
                 }
             }
-        }
+        });
     }
 }
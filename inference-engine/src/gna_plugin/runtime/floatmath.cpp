@@ -1,13 +1,17 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines used by software emulation
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "parallel.hpp"
+
+using GNAPluginNS::runtime::ParallelRanges;
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -19,7 +23,7 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
+    int j, k;
 
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
@@ -27,36 +31,46 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        // columns of B are transposed once, so every output is a dot product of two contiguous vectors
+        std::vector<float> Bt;
+        const float *ptr_b_columns = B;
+        if (N != 1 || ldb != 1) {
+            Bt.resize(static_cast<size_t>(N) * K);
+            for (k = 0; k < K; k++) {
+                for (j = 0; j < N; j++) {
+                    Bt[j * K + k] = B[k * ldb + j];
                 }
-                C[i * ldc + j] = sum;
             }
+            ptr_b_columns = Bt.data();
         }
+        ParallelRanges(M, static_cast<uint64_t>(N) * K, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t row = begin; row < end; row++) {
+                for (int col = 0; col < N; col++) {
+                    float sum = (beta == 1.0) ? C[row * ldc + col] : 0;
+                    C[row * ldc + col] = sum + sdot_unrolled(K, A + row * lda, ptr_b_columns + col * K);
+                }
+            }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
+        ParallelRanges(M, static_cast<uint64_t>(N) * K, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t row = begin; row < end; row++) {
+                for (int col = 0; col < N; col++) {
+                    C[row * ldc + col] = beta * C[row * ldc + col] + alpha * sdot_unrolled(K, A + row * lda, B + col * ldb);
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
+        ParallelRanges(M, static_cast<uint64_t>(N) * K, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t row = begin; row < end; row++) {
+                for (int col = 0; col < N; col++) {
+                    float sum = (beta == 1.0) ? C[row * ldc + col] : 0;
+                    for (int idx = 0; idx < K; idx++) {
+                        sum += A[idx * lda + row] * B[idx * ldb + col];
+                    }
+                    C[row * ldc + col] = sum;
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -66,8 +80,6 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
                   const MKL_INT N, const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *X, const MKL_INT incX,
                   const float beta, float *Y, const MKL_INT incY) {
-    int i;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_ssbmv!\n");
         throw -1;
@@ -81,9 +93,11 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
         throw -1;
     }
     if ((alpha == 1.0) && (beta == 1.0) && (incX == 1) && (incY == 1)) {
-        for (i = 0; i < N; i++) {
-            Y[i] += A[i] * X[i];
-        }
+        ParallelRanges(N, 1, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; i++) {
+                Y[i] += A[i] * X[i];
+            }
+        });
     } else {
         fprintf(stderr, "Only alpha=1, beta=1, incX=1, incY=1, LDA=1 supported in cblas_ssbmv at this time!\n");
         throw -1;
@@ -105,16 +119,26 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        std::vector<float> Bt;
+        const float *ptr_b_columns = B;
+        if (N != 1 || ldb != 1) {
+            Bt.resize(static_cast<size_t>(N) * K);
+            for (k = 0; k < K; k++) {
+                for (j = 0; j < N; j++) {
+                    Bt[j * K + k] = B[k * ldb + j];
                 }
-                C[l * ldc + j] = sum;
             }
+            ptr_b_columns = Bt.data();
         }
+        ParallelRanges(L, static_cast<uint64_t>(N) * K, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t out = begin; out < end; out++) {
+                const uint32_t row = OutputList[out];
+                for (int col = 0; col < N; col++) {
+                    float sum = (beta == 1.0) ? C[out * ldc + col] : 0;
+                    C[out * ldc + col] = sum + sdot_unrolled(K, A + row * lda, ptr_b_columns + col * K);
+                }
+            }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -154,19 +178,32 @@ void sgemv_split(const uint32_t N,
                  const float *B,
                  float *C) {
     uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
+    ParallelRanges(N, num_columns, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            C[i] = B[i] + sdot_unrolled(K1, A1, X + i * num_columns) + sdot_unrolled(K2, A2, X + i * num_columns + K1);
         }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
+    });
+}
+
+// Independent partial sums allow compiler to keep the reduction in vector registers
+float sdot_unrolled(const uint32_t N, const float *X, const float *Y) {
+    constexpr uint32_t num_lanes = 8;
+    float partial[num_lanes] = {};
+    uint32_t i = 0;
+    for (; i + num_lanes <= N; i += num_lanes) {
+        for (uint32_t l = 0; l < num_lanes; l++) {
+            partial[l] += X[i + l] * Y[i + l];
         }
-        C[i] = sum;
     }
+    float sum = 0.0f;
+    for (; i < N; i++) {
+        sum += X[i] * Y[i];
+    }
+    for (uint32_t l = 0; l < num_lanes; l++) {
+        sum += partial[l];
+    }
+    return sum;
 }
 
 #ifdef __cplusplus
@@ -58,6 +58,7 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C);
+float sdot_unrolled(const uint32_t N, const float *X, const float *Y);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,37 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <ie_parallel.hpp>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Splits [0, size) range on chunks processed in parallel. Workloads smaller than a few tens of
+ *        thousands operations are processed in the calling thread since threading overhead exceeds the gain.
+ * @param size      Number of work items
+ * @param itemCost  Approximate number of operations per item
+ * @param func      Functor called with [begin, end) range of items
+ */
+template <typename F>
+void ParallelRanges(uint32_t size, uint64_t itemCost, const F& func) {
+    constexpr uint64_t minChunkCost = 1 << 15;
+    uint64_t numChunks = std::max<uint64_t>(1, size * itemCost / minChunkCost);
+    numChunks = std::min<uint64_t>(numChunks, std::min<uint64_t>(size, parallel_get_max_threads()));
+    if (numChunks <= 1) {
+        func(0u, size);
+        return;
+    }
+    InferenceEngine::parallel_for(static_cast<size_t>(numChunks), [&](size_t chunk) {
+        func(static_cast<uint32_t>(size * chunk / numChunks), static_cast<uint32_t>(size * (chunk + 1) / numChunks));
+    });
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -25,11 +25,14 @@
 #endif
 
 #include "pwl.h"
+#include "parallel.hpp"
 #include "gna_plugin_log.hpp"
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
 
+using GNAPluginNS::runtime::ParallelRanges;
+
 double first_deriv_tanh(const double x) { return(1.0 - tanh(x) * tanh(x)); }
 double first_deriv_exp(const double x) { return(exp(x)); }
 double first_deriv_log(const double x) { return(1.0 / x); }
@@ -930,6 +933,46 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+namespace {
+
+// Applies activation to every element of [num_row_start, num_row_end] x [num_col_start, num_col_end] range
+template <typename F>
+void PwlApply32Elementwise(const float *ptr_in,
+                           float *ptr_out,
+                           uint32_t num_columns,
+                           uint32_t num_row_start,
+                           uint32_t num_row_end,
+                           uint32_t num_col_start,
+                           uint32_t num_col_end,
+                           uint64_t element_cost,
+                           const F &activation) {
+    uint32_t num_rows = num_row_end - num_row_start + 1;
+    uint32_t num_range_columns = num_col_end - num_col_start + 1;
+    if (num_range_columns == num_columns) {
+        // whole rows are one contiguous range
+        const float *ptr_range_in = ptr_in + num_row_start * num_columns;
+        float *ptr_range_out = ptr_out + num_row_start * num_columns;
+        ParallelRanges(num_rows * num_columns, element_cost, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; i++) {
+                ptr_range_out[i] = activation(ptr_range_in[i]);
+            }
+        });
+    } else {
+        ParallelRanges(num_rows, element_cost * num_range_columns, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = num_row_start + begin; i < num_row_start + end; i++) {
+                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
+                    ptr_out[i * num_columns + j] = activation(ptr_in[i * num_columns + j]);
+                }
+            }
+        });
+    }
+}
+
+// Approximate cost of transcendental functions in simple operations
+constexpr uint64_t kTranscendentalCost = 16;
+
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
@@ -941,108 +984,68 @@ void PwlApply32(intel_dnn_component_t *component,
     uint32_t num_columns = component->num_columns_in;
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                kTranscendentalCost, [](float x) -> float { return 0.5 * (1.0 + tanh(0.5 * x)); });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                kTranscendentalCost, [](float x) -> float { return tanh(x); });
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                1, [](float x) -> float { return x / (1.0 + fabs(x)); });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
+        case kActRelu: {
+                float negative_slope = transform->func_id.args.lrelu.negative_slope;
+                PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                    1, [negative_slope](float x) -> float { return (x < 0.0f) ? x * negative_slope : x; });
             }
             break;
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                1, [](float x) -> float { return x; });
             break;
         case kActKaldiLstmClipping:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > KALDI_LSTM_CLIP_UPPER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_UPPER;
-                    } else if (val < KALDI_LSTM_CLIP_LOWER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_LOWER;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                1, [](float x) -> float {
+                    if (x > KALDI_LSTM_CLIP_UPPER) {
+                        return KALDI_LSTM_CLIP_UPPER;
+                    } else if (x < KALDI_LSTM_CLIP_LOWER) {
+                        return KALDI_LSTM_CLIP_LOWER;
                     }
-                }
-            }
+                    return x;
+                });
             break;
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                kTranscendentalCost, [](float x) -> float { return exp(x); });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                kTranscendentalCost, [](float x) -> float { return log(x); });
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                1, [](float x) -> float { return fabs(x); });
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                1, [](float x) -> float { return (x == 0) ? 0.0 : ((x > 0) ? 1.0 : -1.0); });
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                kTranscendentalCost, [](float x) -> float { return -1.0 * log(x); });
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
-                }
-            }
+            PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                kTranscendentalCost, [](float x) -> float { return -0.5 * log(x); });
             break;
         case kActPow: {
                 float exponent = transform->func_id.args.pow.exponent;
                 float scale = transform->func_id.args.pow.scale;
                 float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
-                    }
-                }
+                PwlApply32Elementwise(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                    kTranscendentalCost, [=](float x) -> float { return pow(offset + scale * x, exponent); });
             }
             break;
         case kActCustom:
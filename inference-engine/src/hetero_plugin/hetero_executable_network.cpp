@@ -7,6 +7,7 @@
 #include "hetero_async_infer_request.hpp"
 #include "ie_util_internal.hpp"
 #include "hetero_graph_splitter.hpp"
+#include "hetero_partitioner.hpp"
 #include "hetero_itt.hpp"
 #include "xml_parse_utils.h"
 #include <caseless.hpp>
@@ -383,10 +384,19 @@ void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& net
         }
     }
 
+    CostModelPartitioner partitioner{orderedOps};
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it != _config.end()) {
-            _heteroPlugin->QueryNetwork(network_, _config, queryNetworkResult);
+            // Devices are queried once, the first fit by TARGET_FALLBACK priority is the initial partition
+            auto supportedDevices = _heteroPlugin->QueryNetworkDevices(network_, _config);
+            for (auto&& layerDevices : supportedDevices) {
+                queryNetworkResult.supportedLayersMap.emplace(layerDevices.first, layerDevices.second.front());
+            }
+            auto itPolicy = _config.find(HETERO_CONFIG_KEY(PARTITIONING_POLICY));
+            if (itPolicy != _config.end() && itPolicy->second == HETERO_CONFIG_VALUE(MIN_LATENCY)) {
+                partitioner.Optimize(supportedDevices, queryNetworkResult.supportedLayersMap);
+            }
         } else {
             THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
@@ -473,6 +483,8 @@ void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& net
     if (dumpDotFile) {
         std::ofstream ofstream{"hetero_affinity_" + _name + ".dot"};
         saveGraphToDot(*convertedNetwork, ofstream, HeteroLayerColorer{{devices.begin(), devices.end()}});
+        std::ofstream partitionStream{"hetero_partition_" + _name + ".txt"};
+        partitioner.Dump(partitionStream, queryNetworkResult.supportedLayersMap);
     }
 
     NodeMap<InputSet> nodeInputDependencies;
@@ -967,6 +979,9 @@ void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine
         } else {
             result = std::string{};
         }
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_POLICY)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{HETERO_CONFIG_VALUE(AFFINITY)};
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
@@ -1055,6 +1070,7 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -1077,9 +1093,18 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         result = IE_SET_METRIC(NETWORK_NAME, _name);
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
-        unsigned int value = 0u;
+        // Every request holds own subnetwork requests and moves from one subnetwork to another,
+        // so different devices are busy at the same time when each of them has enough requests in flight.
+        // Subnetworks of the same device compete for it, so the device needs only the largest of their values.
+        std::map<std::string, unsigned int> deviceRequests;
         for (auto&& desc : networks) {
-            value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            auto& requests = deviceRequests[desc._device];
+            requests = std::max(requests,
+                desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+        }
+        unsigned int value = 0u;
+        for (auto&& requests : deviceRequests) {
+            value += requests.second;
         }
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
@@ -0,0 +1,469 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_partitioner.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <details/ie_exception.hpp>
+#include <ngraph/op/fused/matmul.hpp>
+#include <ngraph/op/util/op_types.hpp>
+
+namespace HeteroPlugin {
+
+namespace {
+
+double Elements(const ngraph::Output<ngraph::Node>& output) {
+    const auto& shape = output.get_partial_shape();
+    return shape.is_static() ? static_cast<double>(ngraph::shape_size(shape.to_shape())) : 0.;
+}
+
+double Bytes(const ngraph::Output<ngraph::Node>& output) {
+    return Elements(output) * output.get_element_type().size();
+}
+
+double Flops(const ngraph::Node& node, double inputElements, double outputElements) {
+    const std::string type = node.get_type_name();
+    if (type == "Convolution" || type == "GroupConvolution" || type == "BinaryConvolution" ||
+        type == "ConvolutionBackpropData" || type == "GroupConvolutionBackpropData" ||
+        type == "DeformableConvolution") {
+        const auto& outputShape = node.get_output_partial_shape(0);
+        const auto weights = node.input_value(type == "DeformableConvolution" ? 2 : 1);
+        if (outputShape.is_static() && outputShape.rank().get_length() > 1) {
+            const auto outputChannels = std::max<std::size_t>(1, outputShape.to_shape()[1]);
+            return 2. * outputElements * Elements(weights) / outputChannels;
+        }
+    } else if (auto matMul = dynamic_cast<const ngraph::op::v0::MatMul*>(&node)) {
+        const auto& inputShape = node.get_input_partial_shape(0);
+        if (inputShape.is_static() && inputShape.rank().get_length() > 0) {
+            const auto shape = inputShape.to_shape();
+            const auto k = (matMul->get_transpose_a() && shape.size() > 1) ? shape[shape.size() - 2] : shape.back();
+            return 2. * outputElements * k;
+        }
+    }
+    return std::max(inputElements, outputElements);
+}
+
+double TransferUs(double bytes, const DeviceCostModel& model) {
+    return model.transferGBps > 0. ? bytes / (model.transferGBps * 1e3) : 0.;
+}
+
+}  // namespace
+
+DeviceCostModel GetDeviceCostModel(const std::string& deviceName) {
+    static const std::vector<std::pair<std::string, DeviceCostModel>> models = {
+        {"CPU",     {200.,  20.,    0.,     10.}},
+        {"GPU",     {800.,  40.,    8.,     100.}},
+        {"MYRIAD",  {80.,   4.,     0.3,    1000.}},
+        {"HDDL",    {400.,  4.,     1.,     500.}},
+        {"GNA",     {5.,    2.,     2.,     50.}},
+        {"FPGA",    {500.,  10.,    4.,     200.}},
+    };
+    for (auto&& model : models) {
+        if (deviceName.compare(0, model.first.size(), model.first) == 0) {
+            return model.second;
+        }
+    }
+    return {100., 10., 4., 100.};
+}
+
+CostModelPartitioner::CostModelPartitioner(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps) {
+    std::unordered_map<ngraph::Node*, std::size_t> indices;
+    for (auto&& node : orderedOps) {
+        if (ngraph::op::is_constant(node)) {
+            continue;
+        }
+        Layer layer;
+        layer.node = node;
+        layer.isParameter = ngraph::op::is_parameter(node);
+        layer.isResult = ngraph::op::is_output(node);
+
+        double inputElements = 0., inputBytes = 0.;
+        for (auto&& input : node->inputs()) {
+            const auto source = input.get_source_output();
+            const auto bytes = Bytes(source);
+            inputElements += Elements(source);
+            inputBytes += bytes;
+            auto itProducer = indices.find(source.get_node());
+            if (itProducer != indices.end()) {
+                layer.inputs.push_back({itProducer->second, source.get_index(), bytes});
+                _layers[itProducer->second].consumers.push_back(_layers.size());
+            }
+        }
+        double outputElements = 0., outputBytes = 0.;
+        for (auto&& output : node->outputs()) {
+            outputElements += Elements(output);
+            outputBytes += Bytes(output);
+        }
+
+        if (layer.isParameter) {
+            layer.bytes = outputBytes;
+        } else if (layer.isResult) {
+            layer.bytes = inputBytes;
+        } else {
+            layer.flops = Flops(*node, inputElements, outputElements);
+            layer.bytes = inputBytes + outputBytes;
+        }
+        indices.emplace(node.get(), _layers.size());
+        _layers.push_back(std::move(layer));
+    }
+}
+
+std::size_t CostModelPartitioner::AddDevice(Devices& devices, const std::string& name) const {
+    auto itName = std::find(devices.names.begin(), devices.names.end(), name);
+    if (itName != devices.names.end()) {
+        return std::distance(devices.names.begin(), itName);
+    }
+    const auto model = GetDeviceCostModel(name);
+    std::vector<double> layerUs(_layers.size(), 0.);
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        const auto& layer = _layers[i];
+        if (!layer.isParameter && !layer.isResult) {
+            // Roofline model: a layer is limited either by compute or by memory bandwidth
+            layerUs[i] = std::max(layer.flops / (model.gflops * 1e3), layer.bytes / (model.memoryGBps * 1e3));
+        }
+    }
+    devices.names.push_back(name);
+    devices.models.push_back(model);
+    devices.layerUs.push_back(std::move(layerUs));
+    return devices.names.size() - 1;
+}
+
+CostModelPartitioner::Assignment CostModelPartitioner::GetAssignment(const Affinities& affinities, Devices& devices) const {
+    Assignment assignment(_layers.size());
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        const auto& name = _layers[i].node->get_friendly_name();
+        auto itAffinity = affinities.find(name);
+        if (itAffinity == affinities.end()) {
+            THROW_IE_EXCEPTION << "Layer " << name << " was not assigned on any pointed device.";
+        }
+        assignment[i] = AddDevice(devices, itAffinity->second);
+    }
+    return assignment;
+}
+
+void CostModelPartitioner::PlaceParametersAndResults(Assignment& assignment) const {
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        const auto& layer = _layers[i];
+        if (layer.isParameter && !layer.consumers.empty()) {
+            assignment[i] = assignment[layer.consumers.front()];
+        } else if (layer.isResult && !layer.inputs.empty()) {
+            assignment[i] = assignment[layer.inputs.front().producer];
+        }
+    }
+}
+
+std::vector<std::size_t> CostModelPartitioner::GetFragments(const Assignment& assignment) const {
+    std::vector<std::size_t> parents(_layers.size());
+    std::iota(parents.begin(), parents.end(), 0);
+    auto root = [&] (std::size_t i) {
+        while (parents[i] != i) {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+        }
+        return i;
+    };
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        for (auto&& input : _layers[i].inputs) {
+            if (assignment[input.producer] == assignment[i]) {
+                parents[root(input.producer)] = root(i);
+            }
+        }
+    }
+    std::vector<std::size_t> fragments(_layers.size());
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        fragments[i] = root(i);
+    }
+    return fragments;
+}
+
+PartitionCost CostModelPartitioner::Estimate(const Assignment& assignment, const Devices& devices) const {
+    PartitionCost cost;
+    std::set<std::tuple<std::size_t, std::size_t, std::size_t>> transfers;
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        const auto& layer = _layers[i];
+        const auto device = assignment[i];
+        const auto& model = devices.models[device];
+        cost.computeUs += devices.layerUs[device][i];
+        if (layer.isParameter || layer.isResult) {
+            cost.transferUs += TransferUs(layer.bytes, model);
+        }
+        for (auto&& input : layer.inputs) {
+            const auto producerDevice = assignment[input.producer];
+            // The same data is passed to a device once even if it has several consumers there
+            if (producerDevice != device && transfers.emplace(input.producer, input.port, device).second) {
+                cost.transferUs += TransferUs(input.bytes, devices.models[producerDevice]) + TransferUs(input.bytes, model);
+            }
+        }
+    }
+    const auto fragments = GetFragments(assignment);
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        if (fragments[i] == i) {
+            cost.launchUs += devices.models[assignment[i]].launchUs;
+            cost.subgraphs++;
+        }
+    }
+    return cost;
+}
+
+PartitionCost CostModelPartitioner::Estimate(const Affinities& affinities) const {
+    Devices devices;
+    return Estimate(GetAssignment(affinities, devices), devices);
+}
+
+std::vector<std::size_t> CostModelPartitioner::GetMovedLayers(const std::vector<std::size_t>& group) const {
+    auto moved = group;
+    for (auto&& i : group) {
+        for (auto&& input : _layers[i].inputs) {
+            const auto& producer = _layers[input.producer];
+            if (producer.isParameter && producer.consumers.front() == i) {
+                moved.push_back(input.producer);
+            }
+        }
+        for (auto&& consumer : _layers[i].consumers) {
+            const auto& result = _layers[consumer];
+            if (result.isResult && result.inputs.front().producer == i) {
+                moved.push_back(consumer);
+            }
+        }
+    }
+    std::sort(moved.begin(), moved.end());
+    moved.erase(std::unique(moved.begin(), moved.end()), moved.end());
+    return moved;
+}
+
+double CostModelPartitioner::ProducerTransferUs(std::size_t producer, const Assignment& assignment,
+                                                const Devices& devices) const {
+    const auto producerDevice = assignment[producer];
+    std::set<std::pair<std::size_t, std::size_t>> transfers;
+    double transferUs = 0.;
+    for (auto&& consumer : _layers[producer].consumers) {
+        const auto device = assignment[consumer];
+        for (auto&& input : _layers[consumer].inputs) {
+            if (input.producer == producer && device != producerDevice && transfers.emplace(input.port, device).second) {
+                transferUs += TransferUs(input.bytes, devices.models[producerDevice]) + TransferUs(input.bytes, devices.models[device]);
+            }
+        }
+    }
+    return transferUs;
+}
+
+double CostModelPartitioner::MoveDeltaUs(Assignment& assignment, const std::vector<std::size_t>& fragments,
+                                         const std::vector<std::size_t>& moved, std::size_t device,
+                                         const Devices& devices) const {
+    const auto current = assignment[moved.front()];
+    const auto& currentModel = devices.models[current];
+    const auto& model = devices.models[device];
+    auto isMoved = [&] (std::size_t i) {
+        return std::binary_search(moved.begin(), moved.end(), i);
+    };
+    auto forEachNeighbour = [&] (std::size_t i, const std::function<void(std::size_t)>& f) {
+        for (auto&& input : _layers[i].inputs) {
+            f(input.producer);
+        }
+        for (auto&& consumer : _layers[i].consumers) {
+            f(consumer);
+        }
+    };
+
+    // Compute and host transfers change only for moved layers, transfers between devices only for outputs of
+    // moved layers and of their producers
+    double deltaUs = 0.;
+    std::vector<std::size_t> producers = moved;
+    for (auto&& i : moved) {
+        const auto& layer = _layers[i];
+        deltaUs += devices.layerUs[device][i] - devices.layerUs[current][i];
+        if (layer.isParameter || layer.isResult) {
+            deltaUs += TransferUs(layer.bytes, model) - TransferUs(layer.bytes, currentModel);
+        }
+        for (auto&& input : layer.inputs) {
+            producers.push_back(input.producer);
+        }
+    }
+    std::sort(producers.begin(), producers.end());
+    producers.erase(std::unique(producers.begin(), producers.end()), producers.end());
+    for (auto&& producer : producers) {
+        deltaUs -= ProducerTransferUs(producer, assignment, devices);
+    }
+    for (auto&& i : moved) {
+        assignment[i] = device;
+    }
+    for (auto&& producer : producers) {
+        deltaUs += ProducerTransferUs(producer, assignment, devices);
+    }
+    for (auto&& i : moved) {
+        assignment[i] = current;
+    }
+
+    // Moved layers join neighbour fragments on the target device and may merge them
+    std::map<std::size_t, std::size_t> parents;
+    auto root = [&] (std::size_t i) {
+        while (parents[i] != i) {
+            i = parents[i];
+        }
+        return i;
+    };
+    std::set<std::size_t> touched, joined;
+    for (auto&& i : moved) {
+        parents.emplace(i, i);
+        touched.insert(fragments[i]);
+    }
+    for (auto&& i : moved) {
+        forEachNeighbour(i, [&] (std::size_t neighbour) {
+            if (isMoved(neighbour)) {
+                parents[root(neighbour)] = root(i);
+            } else if (assignment[neighbour] == device) {
+                // fragments are roots of themselves, moved layers are never roots of other device fragments
+                const auto fragment = fragments[neighbour];
+                if (joined.insert(fragment).second) {
+                    parents.emplace(fragment, fragment);
+                }
+                parents[root(fragment)] = root(i);
+            }
+        });
+    }
+    std::size_t merged = 0;
+    for (auto&& parent : parents) {
+        merged += parent.first == parent.second;
+    }
+    deltaUs += model.launchUs * (static_cast<double>(merged) - static_cast<double>(joined.size()));
+
+    // A source fragment disappears or splits into several ones, splits only increase the cost,
+    // so connectivity of the rest is checked if the move can be profitable
+    if (deltaUs - currentModel.launchUs * touched.size() >= 0.) {
+        return deltaUs;
+    }
+    std::unordered_set<std::size_t> visited;
+    std::size_t pieces = 0;
+    for (auto&& i : moved) {
+        forEachNeighbour(i, [&] (std::size_t seed) {
+            if (isMoved(seed) || assignment[seed] != current || !visited.insert(seed).second) {
+                return;
+            }
+            pieces++;
+            std::vector<std::size_t> stack = {seed};
+            while (!stack.empty()) {
+                const auto next = stack.back();
+                stack.pop_back();
+                forEachNeighbour(next, [&] (std::size_t neighbour) {
+                    if (!isMoved(neighbour) && assignment[neighbour] == current && visited.insert(neighbour).second) {
+                        stack.push_back(neighbour);
+                    }
+                });
+            }
+        });
+    }
+    return deltaUs + currentModel.launchUs * (static_cast<double>(pieces) - static_cast<double>(touched.size()));
+}
+
+PartitionCost CostModelPartitioner::Optimize(const SupportedDevices& supportedDevices, Affinities& affinities) const {
+    Devices devices;
+    auto assignment = GetAssignment(affinities, devices);
+    std::vector<std::vector<bool>> allowed(_layers.size());
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        auto itSupported = supportedDevices.find(_layers[i].node->get_friendly_name());
+        if (itSupported != supportedDevices.end()) {
+            for (auto&& name : itSupported->second) {
+                const auto device = AddDevice(devices, name);
+                allowed[i].resize(devices.names.size(), false);
+                allowed[i][device] = true;
+            }
+        }
+    }
+    for (auto&& layerAllowed : allowed) {
+        layerAllowed.resize(devices.names.size(), false);
+    }
+    PlaceParametersAndResults(assignment);
+
+    // Local search: a move of a whole fragment merges it with neighbours on another device,
+    // a move of a single layer shifts a split point or splits a fragment.
+    // Moves are evaluated by the change of the cost in the neighbourhood of moved layers.
+    constexpr double minGainUs = 1e-6;
+    bool improved = true;
+    for (std::size_t step = 0; improved && step < _layers.size(); ++step) {
+        improved = false;
+        auto fragments = GetFragments(assignment);
+        std::map<std::size_t, std::vector<std::size_t>> groups;
+        for (std::size_t i = 0; i < _layers.size(); ++i) {
+            const auto& layer = _layers[i];
+            if (layer.isParameter || layer.isResult) {
+                continue;
+            }
+            groups[fragments[i]].push_back(i);
+            groups[_layers.size() + i].push_back(i);
+        }
+        for (auto&& group : groups) {
+            auto& layers = group.second;
+            if (layers.empty()) {
+                continue;
+            }
+            const auto current = assignment[layers.front()];
+            const auto moved = GetMovedLayers(layers);
+            for (std::size_t device = 0; device < devices.names.size(); ++device) {
+                if (device == current || std::any_of(layers.begin(), layers.end(), [&] (std::size_t i) {
+                        return assignment[i] != current || !allowed[i][device];
+                    })) {
+                    continue;
+                }
+                if (MoveDeltaUs(assignment, fragments, moved, device, devices) < -minGainUs) {
+                    for (auto&& i : moved) {
+                        assignment[i] = device;
+                    }
+                    fragments = GetFragments(assignment);
+                    improved = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        affinities[_layers[i].node->get_friendly_name()] = devices.names[assignment[i]];
+    }
+    return Estimate(assignment, devices);
+}
+
+void CostModelPartitioner::Dump(std::ostream& stream, const Affinities& affinities) const {
+    Devices devices;
+    const auto assignment = GetAssignment(affinities, devices);
+    const auto cost = Estimate(assignment, devices);
+    const auto fragments = GetFragments(assignment);
+
+    stream << "# layer\ttype\tdevice\testimated_us" << std::endl;
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        stream << _layers[i].node->get_friendly_name() << '\t' << _layers[i].node->get_type_name() << '\t'
+               << devices.names[assignment[i]] << '\t' << devices.layerUs[assignment[i]][i] << std::endl;
+    }
+
+    std::map<std::size_t, std::size_t> fragmentIds;
+    std::vector<std::size_t> fragmentLayers;
+    std::vector<double> fragmentUs;
+    std::vector<std::string> fragmentDevices;
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        auto emplaced = fragmentIds.emplace(fragments[i], fragmentIds.size());
+        if (emplaced.second) {
+            fragmentLayers.push_back(0);
+            fragmentUs.push_back(0.);
+            fragmentDevices.push_back(devices.names[assignment[i]]);
+        }
+        auto id = emplaced.first->second;
+        fragmentLayers[id]++;
+        fragmentUs[id] += devices.layerUs[assignment[i]][i];
+    }
+    stream << std::endl << "# subgraph\tdevice\tlayers\testimated_us" << std::endl;
+    for (std::size_t id = 0; id < fragmentLayers.size(); ++id) {
+        stream << id << '\t' << fragmentDevices[id] << '\t' << fragmentLayers[id] << '\t' << fragmentUs[id] << std::endl;
+    }
+
+    stream << std::endl << "# compute_us\ttransfer_us\tlaunch_us\ttotal_us" << std::endl;
+    stream << cost.computeUs << '\t' << cost.transferUs << '\t' << cost.launchUs << '\t' << cost.TotalUs() << std::endl;
+}
+
+}  // namespace HeteroPlugin
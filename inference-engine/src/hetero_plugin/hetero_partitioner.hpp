@@ -0,0 +1,127 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <ngraph/node.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Static performance characteristics of a device used to estimate execution time of layers
+ */
+struct DeviceCostModel {
+    double gflops;          //!< Sustained compute throughput
+    double memoryGBps;      //!< Bandwidth of device memory
+    double transferGBps;    //!< Bandwidth of host <-> device transfers, 0 if device works with host memory
+    double launchUs;        //!< Overhead of inference of one subnetwork
+};
+
+/**
+ * @brief Returns cost model for a device from TARGET_FALLBACK list, device ID is ignored
+ */
+DeviceCostModel GetDeviceCostModel(const std::string& deviceName);
+
+/**
+ * @brief Estimated latency of a network split on subnetworks, in microseconds
+ */
+struct PartitionCost {
+    double      computeUs = 0.;
+    double      transferUs = 0.;
+    double      launchUs = 0.;
+    std::size_t subgraphs = 0;
+
+    double TotalUs() const {
+        return computeUs + transferUs + launchUs;
+    }
+};
+
+/**
+ * @brief Assigns layers to devices minimizing estimated end-to-end latency of sequentially executed subnetworks.
+ *        Cost of a layer is estimated by roofline of FLOP count and accessed bytes, cost of a split by the size of
+ *        data passed between devices and by subnetwork inference overhead.
+ */
+class CostModelPartitioner {
+public:
+    /**
+     * @brief Device assigned to a layer by the layer name
+     */
+    using Affinities = std::map<std::string, std::string>;
+    /**
+     * @brief Devices which support a layer ordered by TARGET_FALLBACK priority by the layer name
+     */
+    using SupportedDevices = std::map<std::string, std::vector<std::string>>;
+
+    /**
+     * @param orderedOps    Topologically sorted network operations without constants
+     */
+    explicit CostModelPartitioner(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps);
+
+    /**
+     * @brief Estimates latency of the network with given layer affinities
+     */
+    PartitionCost Estimate(const Affinities& affinities) const;
+
+    /**
+     * @brief Moves connected fragments of layers and single layers to other supported devices while it reduces
+     *        estimated latency. Parameters and results are placed together with their consumers and producers.
+     * @param supportedDevices  Devices available for every layer
+     * @param affinities        Initial affinities, replaced with the resulting partition
+     * @return Estimated cost of the resulting partition
+     */
+    PartitionCost Optimize(const SupportedDevices& supportedDevices, Affinities& affinities) const;
+
+    /**
+     * @brief Writes per layer estimates, resulting subnetworks and total cost in a human readable form
+     */
+    void Dump(std::ostream& stream, const Affinities& affinities) const;
+
+private:
+    struct Input {
+        std::size_t producer;
+        std::size_t port;
+        double      bytes;
+    };
+
+    struct Layer {
+        std::shared_ptr<ngraph::Node>   node;
+        double                          flops = 0.;
+        double                          bytes = 0.;
+        std::vector<Input>              inputs;     // inputs which are not constants
+        std::vector<std::size_t>        consumers;
+        bool                            isParameter = false;
+        bool                            isResult = false;
+    };
+
+    // Device index for every layer
+    using Assignment = std::vector<std::size_t>;
+
+    struct Devices {
+        std::vector<std::string>            names;
+        std::vector<DeviceCostModel>        models;
+        std::vector<std::vector<double>>    layerUs;    // estimated time of every layer on every device
+    };
+
+    std::size_t AddDevice(Devices& devices, const std::string& name) const;
+    Assignment GetAssignment(const Affinities& affinities, Devices& devices) const;
+    void PlaceParametersAndResults(Assignment& assignment) const;
+    std::vector<std::size_t> GetFragments(const Assignment& assignment) const;
+    PartitionCost Estimate(const Assignment& assignment, const Devices& devices) const;
+    // A group of layers together with parameters and results which follow them
+    std::vector<std::size_t> GetMovedLayers(const std::vector<std::size_t>& group) const;
+    double ProducerTransferUs(std::size_t producer, const Assignment& assignment, const Devices& devices) const;
+    // Change of the estimated latency if moved layers are assigned to the device, exact only for negative values
+    double MoveDeltaUs(Assignment& assignment, const std::vector<std::size_t>& fragments,
+                       const std::vector<std::size_t>& moved, std::size_t device, const Devices& devices) const;
+
+    std::vector<Layer> _layers;
+};
+
+}  // namespace HeteroPlugin
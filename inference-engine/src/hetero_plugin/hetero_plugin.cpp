@@ -4,6 +4,7 @@
 
 #include "ie_metric_helpers.hpp"
 #include "hetero_plugin.hpp"
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <map>
@@ -32,6 +33,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PARTITIONING_POLICY)] = HETERO_CONFIG_VALUE(AFFINITY);
 }
 
 namespace {
@@ -55,6 +57,11 @@ InferenceEngine::ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const
     if (it == tconfig.end()) {
         THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
     }
+    auto itPolicy = tconfig.find(HETERO_CONFIG_KEY(PARTITIONING_POLICY));
+    if (itPolicy->second != HETERO_CONFIG_VALUE(AFFINITY) && itPolicy->second != HETERO_CONFIG_VALUE(MIN_LATENCY)) {
+        THROW_IE_EXCEPTION << "Unsupported value " << itPolicy->second << " for "
+                           << HETERO_CONFIG_KEY(PARTITIONING_POLICY) << " config key";
+    }
     DeviceMetaInformationMap metaDevices = GetDevicePlugins(it->second, tconfig);
 
     if (network.getFunction()) {
@@ -193,7 +200,8 @@ void Engine::SetAffinity(InferenceEngine::ICNNNetwork &network, const Configs &c
     }
 }
 
-void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, QueryNetworkResult &qr) const {
+std::map<std::string, std::vector<std::string>> Engine::QueryNetworkDevices(const ICNNNetwork &network,
+                                                                            const Configs& config) const {
     if (GetCore() == nullptr) {
         THROW_IE_EXCEPTION << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -224,7 +232,8 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
                     [&] (const DeviceMetaInformationMap::value_type& metaDevice) -> bool {
                         auto& deviceName = metaDevice.first;
                         auto clonedNetwork = cloneNetwork(network);
-                        try { GetCore()->QueryNetwork(*clonedNetwork, deviceName, metaDevice.second); }
+                        // keep the result to not query the device once again
+                        try { queryResults[deviceName] = GetCore()->QueryNetwork(*clonedNetwork, deviceName, metaDevice.second); }
                         catch (const InferenceEngine::details::InferenceEngineException & ex) {
                             std::string message = ex.what();
                             return message.find(NOT_IMPLEMENTED_str) == std::string::npos;
@@ -235,7 +244,14 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
             auto cnnNetworkImpl = std::make_shared<details::CNNNetworkImpl>(network);
             queryNetwork(*cnnNetworkImpl);
         } else {
-            queryNetwork(network);
+            // devices that failed the probe with other errors are queried once again
+            for (auto&& metaDevice : metaDevices) {
+                auto& deviceName = metaDevice.first;
+                if (queryResults.find(deviceName) == queryResults.end()) {
+                    auto clonedNetwork = cloneNetwork(network);
+                    queryResults[deviceName] = GetCore()->QueryNetwork(*clonedNetwork, deviceName, metaDevice.second);
+                }
+            }
         }
     } else {
         queryNetwork(network);
@@ -244,11 +260,22 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
+    std::map<std::string, std::vector<std::string>> supportedDevices;
     for (auto&& deviceName : fallbackDevices) {
         for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
-            qr.supportedLayersMap.emplace(layerQueryResult);
+            auto& devices = supportedDevices[layerQueryResult.first];
+            if (std::find(devices.begin(), devices.end(), layerQueryResult.second) == devices.end()) {
+                devices.push_back(layerQueryResult.second);
+            }
         }
     }
+    return supportedDevices;
+}
+
+void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, QueryNetworkResult &qr) const {
+    for (auto&& supportedDevices : QueryNetworkDevices(network, config)) {
+        qr.supportedLayersMap.emplace(supportedDevices.first, supportedDevices.second.front());
+    }
 
     // set OK status
     qr.rc = StatusCode::OK;
@@ -263,6 +290,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(FULL_DEVICE_NAME) == name) {
@@ -278,6 +306,8 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_POLICY)) {
+        return { _config.at(HETERO_CONFIG_KEY(PARTITIONING_POLICY)) };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -43,6 +43,13 @@ public:
 
     void SetAffinity(InferenceEngine::ICNNNetwork& network, const Configs &config);
 
+    /**
+     * @brief Queries every device from TARGET_FALLBACK list
+     * @return Devices which support a layer ordered by fallback priority for every layer name
+     */
+    std::map<std::string, std::vector<std::string>> QueryNetworkDevices(const InferenceEngine::ICNNNetwork &network,
+                                                                        const Configs& config) const;
+
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback,
         const Configs & localConfig) const;
 
@@ -192,6 +192,46 @@ void verifyI420BlobInput(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr
     }
 }
 
+TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
+    if (blobs.empty()) {
+        THROW_IE_EXCEPTION << "Batched blob must contain at least one image";
+    }
+
+    if (std::any_of(blobs.begin(), blobs.end(), [](const Blob::Ptr& blob) {
+            return blob == nullptr;
+        })) {
+        THROW_IE_EXCEPTION << "Cannot create a batched blob from nullptr Blob objects";
+    }
+
+    // images of one kind are processed by the same pre-processing graph
+    const auto kind = [](const Blob::Ptr& blob) {
+        return blob->is<NV12Blob>() ? 1 : blob->is<I420Blob>() ? 2 : blob->is<CompoundBlob>() ? 3 : 0;
+    };
+    const auto& first = blobs.front();
+    if (kind(first) == 3) {
+        THROW_IE_EXCEPTION << "Batched blob images must be memory, NV12 or I420 blobs";
+    }
+
+    for (const auto& blob : blobs) {
+        if (kind(blob) != kind(first)) {
+            THROW_IE_EXCEPTION << "Batched blob images must be blobs of the same type";
+        }
+        if (blob->getTensorDesc().getPrecision() != first->getTensorDesc().getPrecision()) {
+            THROW_IE_EXCEPTION << "Batched blob images must have the same precision, actual: "
+                               << blob->getTensorDesc().getPrecision() << " and "
+                               << first->getTensorDesc().getPrecision();
+        }
+        const auto& dims = blob->is<CompoundBlob>()
+            ? blob->as<CompoundBlob>()->getBlob(0)->getTensorDesc().getDims()
+            : blob->getTensorDesc().getDims();
+        if (dims.size() != 4 || dims[0] != 1) {
+            THROW_IE_EXCEPTION << "Batched blob images must be 4D tensors with batch size 1";
+        }
+    }
+
+    return TensorDesc(first->getTensorDesc().getPrecision(), {}, first->getTensorDesc().getLayout());
+}
+
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(): Blob(TensorDesc(Precision::UNSPECIFIED, {}, Layout::ANY)) {}
@@ -412,4 +452,38 @@ Blob::Ptr I420Blob::createROI(const ROI& roi) const {
     return std::make_shared<I420Blob>(yRoiBlob, uRoiBlob, vRoiBlob);
 }
 
+BatchedBlob::BatchedBlob(const std::vector<Blob::Ptr>& blobs) {
+    tensorDesc = verifyBatchedBlobInput(blobs);
+    _blobs = blobs;
+}
+
+BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs) {
+    tensorDesc = verifyBatchedBlobInput(blobs);
+    _blobs = std::move(blobs);
+}
+
+BatchedBlob::~BatchedBlob() {}
+
+Blob::Ptr BatchedBlob::createROI(const ROI& roi) const {
+    std::vector<Blob::Ptr> roiBlobs;
+    roiBlobs.reserve(_blobs.size());
+
+    for (const auto& blob : _blobs) {
+        roiBlobs.push_back(blob->createROI(roi));
+    }
+
+    return std::make_shared<BatchedBlob>(std::move(roiBlobs));
+}
+
+Blob::Ptr make_shared_blob(const Blob::Ptr& inputBlob, const std::vector<ROI>& rois) {
+    std::vector<Blob::Ptr> roiBlobs;
+    roiBlobs.reserve(rois.size());
+
+    for (const auto& roi : rois) {
+        roiBlobs.push_back(inputBlob->createROI(roi));
+    }
+
+    return std::make_shared<BatchedBlob>(std::move(roiBlobs));
+}
+
 }  // namespace InferenceEngine
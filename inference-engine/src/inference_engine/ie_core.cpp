@@ -8,6 +8,7 @@
 #include <vector>
 #include <istream>
 #include <mutex>
+#include <sstream>
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
@@ -18,6 +19,8 @@
 #include "ie_itt.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "ie_executable_network_cache.hpp"
+#include "cnn_network_ngraph_impl.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -84,6 +87,100 @@ Parameter copyParameterValue(const Parameter & value) {
     return std::move(value);
 }
 
+bool isExecNetworkCacheKey(const std::string& key) {
+    return key == KEY_EXEC_NETWORK_CACHE_CAPACITY || key == KEY_EXEC_NETWORK_CACHE_MEMORY_BUDGET;
+}
+
+size_t parseExecNetworkCacheValue(const std::string& key, const std::string& value) {
+    std::size_t pos = 0;
+    unsigned long long result = 0;  // NOLINT
+    try {
+        result = std::stoull(value, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (value.empty() || pos != value.size() || value[0] == '-') {
+        THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << key
+                           << ". Expected only non-negative integer numbers";
+    }
+    return static_cast<size_t>(result);
+}
+
+/**
+ * @brief Appends size and raw bytes of data to the key, so values are compared exactly
+ */
+void appendKeyBytes(std::stringstream& key, const void* data, size_t size) {
+    key << size << ':';
+    key.write(static_cast<const char*>(data), size);
+}
+
+/**
+ * @brief Builds a key of executable network cache entry
+ * Only the network settings which affect compilation are taken into account: the function identity,
+ * input/output precisions and layouts and input preprocessing with mean and scale values and mean images.
+ * Plugins configuration is not a part of the key, the cache is cleared when it's changed.
+ */
+std::string makeExecNetworkCacheKey(const CNNNetwork& network, const ICNNNetwork::InputShapes& inputShapes,
+                                    const std::string& deviceName, const std::map<std::string, std::string>& config) {
+    std::stringstream key;
+    key << network.getFunction().get() << ';';
+    for (auto&& input : network.getInputsInfo()) {
+        const auto& preProcess = input.second->getPreProcess();
+        key << "i:" << input.first << ',' << input.second->getPrecision() << ',' << input.second->getLayout()
+            << ',' << preProcess.getResizeAlgorithm() << ',' << preProcess.getColorFormat() << ','
+            << preProcess.getMeanVariant();
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            const auto& channel = preProcess[c];
+            key << ",m";
+            appendKeyBytes(key, &channel->meanValue, sizeof(channel->meanValue));
+            key << ",s";
+            appendKeyBytes(key, &channel->stdScale, sizeof(channel->stdScale));
+            key << ",d";
+            auto meanData = as<MemoryBlob>(channel->meanData);
+            if (meanData) {
+                auto locked = meanData->rmap();
+                appendKeyBytes(key, locked.as<const void*>(), meanData->byteSize());
+            } else {
+                appendKeyBytes(key, nullptr, 0);
+            }
+        }
+        key << ';';
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        key << "o:" << output.first << ',' << output.second->getPrecision() << ',' << output.second->getLayout()
+            << ';';
+    }
+    for (auto&& shape : inputShapes) {
+        key << "s:" << shape.first;
+        for (auto&& dim : shape.second) {
+            key << ',' << dim;
+        }
+        key << ';';
+    }
+    key << "d:" << deviceName << ';';
+    for (auto&& value : config) {
+        key << "c:" << value.first << '=' << value.second << ';';
+    }
+    return key.str();
+}
+
+/**
+ * @brief Estimates memory footprint of a compiled network as a total size of constants and intermediate tensors
+ */
+size_t estimateFootprint(const std::shared_ptr<const ngraph::Function>& function) {
+    size_t footprint = 0;
+    for (auto&& op : function->get_ops()) {
+        for (size_t i = 0; i < op->get_output_size(); i++) {
+            const auto& shape = op->get_output_partial_shape(i);
+            const auto& type = op->get_output_element_type(i);
+            if (shape.is_static() && type.is_static()) {
+                footprint += ngraph::shape_size(shape.to_shape()) * type.size();
+            }
+        }
+    }
+    return footprint;
+}
+
 }  // namespace
 
 DeviceIDParser::DeviceIDParser(const std::string& deviceNameWithID) {
@@ -161,6 +258,9 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    // keeps executable networks loaded for different input shapes, destroyed before plugins
+    details::ExecutableNetworkCache execNetworkCache;
+
 public:
     Impl();
     ~Impl() override;
@@ -260,6 +360,57 @@ public:
         return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
     }
 
+    ExecutableNetwork LoadNetwork(const CNNNetwork& network, const ICNNNetwork::InputShapes& inputShapes,
+                                  const std::string& deviceName, const std::map<std::string, std::string>& config) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork::Reshape");
+        auto function = network.getFunction();
+        if (function == nullptr) {
+            THROW_IE_EXCEPTION << "LoadNetwork with input shapes is supported only for networks represented "
+                                  "as ngraph::Function";
+        }
+
+        auto key = makeExecNetworkCacheKey(network, inputShapes, deviceName, config);
+        return execNetworkCache.getOrLoad(key, function, [&](size_t& footprint) {
+            auto currentShapes = network.getInputShapes();
+            bool sameShapes = true;
+            for (auto&& shape : inputShapes) {
+                auto current = currentShapes.find(shape.first);
+                if (current == currentShapes.end()) {
+                    THROW_IE_EXCEPTION << "Network does not have input with name " << shape.first;
+                }
+                sameShapes = sameShapes && current->second == shape.second;
+            }
+            if (sameShapes) {
+                footprint = estimateFootprint(function);
+                return LoadNetwork(network, deviceName, config);
+            }
+
+            // copy keeps input precisions, layouts and preprocessing of the original network
+            auto copy = std::make_shared<details::CNNNetworkNGraphImpl>(static_cast<const ICNNNetwork&>(network));
+            CNNNetwork reshaped(copy);
+            reshaped.reshape(inputShapes);
+            footprint = estimateFootprint(reshaped.getFunction());
+            return LoadNetwork(reshaped, deviceName, config);
+        });
+    }
+
+    void SetExecNetworkCacheConfig(const std::map<std::string, std::string>& config) {
+        for (auto&& value : config) {
+            if (value.first == KEY_EXEC_NETWORK_CACHE_CAPACITY) {
+                execNetworkCache.setCapacity(parseExecNetworkCacheValue(value.first, value.second));
+            } else if (value.first == KEY_EXEC_NETWORK_CACHE_MEMORY_BUDGET) {
+                execNetworkCache.setMemoryBudget(parseExecNetworkCacheValue(value.first, value.second) << 20);
+            }
+        }
+    }
+
+    Parameter GetExecNetworkCacheConfig(const std::string& name) const {
+        if (name == KEY_EXEC_NETWORK_CACHE_CAPACITY) {
+            return std::to_string(execNetworkCache.getCapacity());
+        }
+        return std::to_string(execNetworkCache.getMemoryBudget() >> 20);
+    }
+
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
                                     const std::map<std::string, std::string>& config) override {
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
@@ -305,6 +456,17 @@ public:
             }
         }
 
+        // Core level metrics
+        if (deviceName.empty()) {
+            if (name == METRIC_KEY(EXEC_NETWORK_CACHE_HITS)) {
+                return execNetworkCache.getHits();
+            } else if (name == METRIC_KEY(EXEC_NETWORK_CACHE_MISSES)) {
+                return execNetworkCache.getMisses();
+            } else if (name == METRIC_KEY(EXEC_NETWORK_CACHE_EVICTIONS)) {
+                return execNetworkCache.getEvictions();
+            }
+        }
+
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
         // we need to return a copy of Parameter object which is created on Core side,
@@ -458,6 +620,11 @@ public:
                 plugin.second.SetConfig(config);
             }
         }
+
+        // networks compiled with the previous configuration are not reused
+        if (!config.empty()) {
+            execNetworkCache.clear();
+        }
     }
 
     /**
@@ -571,6 +738,12 @@ ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, const std::string
     return _impl->LoadNetwork(network, deviceName, config);
 }
 
+ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, const ICNNNetwork::InputShapes& inputShapes,
+                                    const std::string& deviceName,
+                                    const std::map<std::string, std::string>& config) {
+    return _impl->LoadNetwork(network, inputShapes, deviceName, config);
+}
+
 void Core::AddExtension(const IExtensionPtr& extension) {
     _impl->AddExtension(extension);
 }
@@ -690,7 +863,17 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
     }
 
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        // Core level options are not passed to plugins
+        std::map<std::string, std::string> pluginsConfig;
+        for (auto&& value : config) {
+            if (!isExecNetworkCacheKey(value.first)) {
+                pluginsConfig.insert(value);
+            }
+        }
+        _impl->SetExecNetworkCacheConfig(config);
+        if (!pluginsConfig.empty() || config.empty()) {
+            _impl->SetConfigForPlugins(pluginsConfig, std::string());
+        }
     } else {
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
@@ -715,6 +898,10 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
         }
     }
 
+    if (deviceName.empty() && isExecNetworkCacheKey(name)) {
+        return _impl->GetExecNetworkCacheConfig(name);
+    }
+
     auto parsed = parseDeviceNameIntoConfig(deviceName);
 
     // we need to return a copy of Parameter object which is created on Core side,
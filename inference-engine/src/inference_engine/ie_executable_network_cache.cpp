@@ -0,0 +1,125 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_executable_network_cache.hpp"
+
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+ExecutableNetworkCache::ExecutableNetworkCache(size_t capacity, size_t memoryBudget)
+    : _capacity(capacity), _memoryBudget(memoryBudget) {}
+
+ExecutableNetwork ExecutableNetworkCache::getOrLoad(const std::string& key, const std::weak_ptr<const void>& owner,
+                                                    const Loader& loader) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto found = _index.find(key);
+        if (found != _index.end()) {
+            auto entry = found->second;
+            if (!entry->owner.expired()) {
+                _entries.splice(_entries.begin(), _entries, entry);
+                _hits++;
+                return entry->network;
+            }
+            // the key may belong to another object allocated at the same address
+            erase(entry);
+        }
+        _misses++;
+    }
+
+    // loading takes long, so other networks can be requested meanwhile
+    size_t footprint = 0;
+    ExecutableNetwork network = loader(footprint);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_capacity == 0) {
+        return network;
+    }
+    auto found = _index.find(key);
+    if (found != _index.end()) {
+        // the same network was loaded concurrently
+        erase(found->second);
+    }
+    _entries.push_front({key, owner, network, footprint});
+    _index[key] = _entries.begin();
+    _footprint += footprint;
+    evict();
+    return network;
+}
+
+void ExecutableNetworkCache::erase(Entries::iterator entry) {
+    _footprint -= entry->footprint;
+    _index.erase(entry->key);
+    _entries.erase(entry);
+}
+
+void ExecutableNetworkCache::evict() {
+    // entries of destroyed owners are useless and dropped first
+    for (auto entry = _entries.begin(); entry != _entries.end();) {
+        auto current = entry++;
+        if (current->owner.expired()) {
+            erase(current);
+        }
+    }
+    // the most recently used network is kept even if it exceeds the budget alone
+    while (!_entries.empty() &&
+           (_entries.size() > _capacity || (_memoryBudget != 0 && _footprint > _memoryBudget && _entries.size() > 1))) {
+        erase(std::prev(_entries.end()));
+        _evictions++;
+    }
+}
+
+void ExecutableNetworkCache::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    evict();
+}
+
+void ExecutableNetworkCache::setMemoryBudget(size_t memoryBudget) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _memoryBudget = memoryBudget;
+    evict();
+}
+
+size_t ExecutableNetworkCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+}
+
+size_t ExecutableNetworkCache::getMemoryBudget() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryBudget;
+}
+
+unsigned int ExecutableNetworkCache::getHits() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hits;
+}
+
+unsigned int ExecutableNetworkCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _misses;
+}
+
+unsigned int ExecutableNetworkCache::getEvictions() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _evictions;
+}
+
+size_t ExecutableNetworkCache::size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+void ExecutableNetworkCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _index.clear();
+    _footprint = 0;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
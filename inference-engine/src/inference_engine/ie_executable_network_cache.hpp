@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_executable_network.hpp>
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Least recently used cache of executable networks limited by number of networks and their estimated
+ * memory footprint
+ */
+class ExecutableNetworkCache {
+public:
+    /**
+     * @brief Loads a network on cache miss
+     * @param footprint estimated memory footprint of the loaded network in bytes
+     * @return Loaded executable network
+     */
+    using Loader = std::function<ExecutableNetwork(size_t& footprint)>;
+
+    explicit ExecutableNetworkCache(size_t capacity = 8, size_t memoryBudget = 0);
+
+    /**
+     * @brief Returns the network cached for the key or loads and caches it
+     * @param key key of the network, e.g. serialized model identity, device, config and input shapes
+     * @param owner object the cached network depends on, entry is dropped when the object is destroyed
+     * @param loader function called on cache miss, it's called without holding the cache lock
+     * @return Executable network
+     */
+    ExecutableNetwork getOrLoad(const std::string& key, const std::weak_ptr<const void>& owner, const Loader& loader);
+
+    /**
+     * @brief Sets maximum number of cached networks, 0 disables the cache
+     */
+    void setCapacity(size_t capacity);
+
+    /**
+     * @brief Sets limit of total estimated footprint of cached networks in bytes, 0 means no limit
+     */
+    void setMemoryBudget(size_t memoryBudget);
+
+    size_t getCapacity() const;
+    size_t getMemoryBudget() const;
+
+    unsigned int getHits() const;
+    unsigned int getMisses() const;
+    unsigned int getEvictions() const;
+
+    /**
+     * @brief Returns number of cached networks
+     */
+    size_t size() const;
+
+    /**
+     * @brief Drops all cached networks, statistics is kept
+     */
+    void clear();
+
+private:
+    struct Entry {
+        std::string key;
+        std::weak_ptr<const void> owner;
+        ExecutableNetwork network;
+        size_t footprint;
+    };
+    using Entries = std::list<Entry>;
+
+    // must be called under the lock
+    void erase(Entries::iterator entry);
+    void evict();
+
+    mutable std::mutex _mutex;
+    // most recently used entries are at the beginning
+    Entries _entries;
+    std::unordered_map<std::string, Entries::iterator> _index;
+    size_t _capacity;
+    size_t _memoryBudget;
+    size_t _footprint = 0;
+    unsigned int _hits = 0;
+    unsigned int _misses = 0;
+    unsigned int _evictions = 0;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,56 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory mapped files
+ * @file ie_mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Read-only view on a memory mapped file. Pages are mapped as copy-on-write, so modifications
+ *        of the data are private for the process and never reach the file.
+ */
+class MappedMemory {
+public:
+    using Ptr = std::shared_ptr<MappedMemory>;
+
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns a pointer to the beginning of the mapped file
+     * @return Pointer to data
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns a size of the mapped file
+     * @return Size in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps a file into the process memory
+ * @param path Path to a file
+ * @return Mapped memory object, the file is unmapped when the object is destroyed
+ */
+MappedMemory::Ptr load_mmap_object(const std::string& path);
+
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+/**
+ * @brief Maps a file into the process memory
+ * @param path Path to a file
+ * @return Mapped memory object, the file is unmapped when the object is destroyed
+ */
+MappedMemory::Ptr load_mmap_object(const std::wstring& path);
+#endif
+
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mmap_object.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -83,6 +84,11 @@ public:
         auto reader = getReaderPtr();
         return reader->read(model, weights, exts);
     }
+    CNNNetwork readFile(std::istream& model, const std::string& modelPath,
+                        const std::vector<IExtensionPtr>& exts) const override {
+        auto reader = getReaderPtr();
+        return reader->readFile(model, modelPath, exts);
+    }
     std::vector<std::string> getDataFileExtensions() const override {
         auto reader = getReaderPtr();
         return reader->getDataFileExtensions();
@@ -153,6 +159,19 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
         "version of the OpenVINO to generate supported IR version.";
 }
 
+/**
+ * @brief Weights blob which keeps the memory mapped file alive while the blob is used
+ */
+class MappedBlob : public TBlob<uint8_t> {
+    MappedMemory::Ptr mappedMemory;
+
+public:
+    explicit MappedBlob(const MappedMemory::Ptr& memory) :
+        TBlob<uint8_t>(TensorDesc(Precision::U8, {memory->size()}, Layout::C),
+                       reinterpret_cast<uint8_t*>(memory->data()), memory->size()),
+        mappedMemory(memory) { }
+};
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
@@ -201,6 +220,22 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
+                MappedMemory::Ptr mappedWeights;
+                try {
+                    mappedWeights = load_mmap_object(weights_path);
+                } catch (const details::InferenceEngineException&) {
+                    THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
+                }
+
+                if (mappedWeights->size() != 0) {
+                    // Weights are shared with the network, so pages of the file are loaded on demand
+                    // and can be reused by several processes which read the same model
+                    details::BlobStream binStream(std::make_shared<MappedBlob>(mappedWeights));
+                    auto network = reader->read(modelStream, binStream, exts);
+                    modelStream.close();
+                    return network;
+                }
+
                 std::ifstream binStream;
                 binStream.open(weights_path, std::ios::binary);
                 if (!binStream.is_open())
@@ -212,7 +247,7 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 return network;
             }
             // read model without weights
-            return reader->read(modelStream, exts);
+            return reader->readFile(modelStream, modelPath, exts);
         }
     }
     THROW_IE_EXCEPTION << "Unknown model format! Cannot find reader for model format: " << fileExt << " and read the model: " << modelPath <<
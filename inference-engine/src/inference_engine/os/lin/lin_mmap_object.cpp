@@ -0,0 +1,68 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "details/ie_exception.hpp"
+#include "ie_mmap_object.hpp"
+
+namespace InferenceEngine {
+
+class LinuxMappedMemory : public MappedMemory {
+private:
+    char* _data = nullptr;
+    size_t _size = 0;
+
+public:
+    explicit LinuxMappedMemory(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            THROW_IE_EXCEPTION << "Cannot open file " << path << " for mapping: " << std::strerror(errno);
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1) {
+            close(fd);
+            THROW_IE_EXCEPTION << "Cannot get size of file " << path << ": " << std::strerror(errno);
+        }
+        _size = static_cast<size_t>(sb.st_size);
+
+        if (_size > 0) {
+            // MAP_PRIVATE makes pages copy-on-write, so in-place changes of weights never reach the file
+            void* data = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                THROW_IE_EXCEPTION << "Cannot map file " << path << ": " << std::strerror(errno);
+            }
+            _data = static_cast<char*>(data);
+        }
+        // the mapping stays valid after the descriptor is closed
+        close(fd);
+    }
+
+    ~LinuxMappedMemory() override {
+        if (_data != nullptr) {
+            munmap(_data, _size);
+        }
+    }
+
+    char* data() noexcept override {
+        return _data;
+    }
+
+    size_t size() const noexcept override {
+        return _size;
+    }
+};
+
+MappedMemory::Ptr load_mmap_object(const std::string& path) {
+    return std::make_shared<LinuxMappedMemory>(path);
+}
+
+}  // namespace InferenceEngine
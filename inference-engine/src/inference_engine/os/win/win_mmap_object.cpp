@@ -0,0 +1,88 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "details/ie_exception.hpp"
+#include "ie_mmap_object.hpp"
+#include "file_utils.h"
+
+#include <windows.h>
+
+namespace InferenceEngine {
+
+class WindowsMappedMemory : public MappedMemory {
+private:
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = NULL;
+    char* _data = nullptr;
+    size_t _size = 0;
+
+    void release() {
+        if (_data != nullptr) UnmapViewOfFile(_data);
+        if (_mapping != NULL) CloseHandle(_mapping);
+        if (_file != INVALID_HANDLE_VALUE) CloseHandle(_file);
+    }
+
+    void map(const std::string& path) {
+        if (_file == INVALID_HANDLE_VALUE)
+            THROW_IE_EXCEPTION << "Cannot open file " << path << " for mapping: " << GetLastError();
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(_file, &fileSize)) {
+            release();
+            THROW_IE_EXCEPTION << "Cannot get size of file " << path << ": " << GetLastError();
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        if (_size == 0)
+            return;
+
+        // PAGE_WRITECOPY together with FILE_MAP_COPY gives copy-on-write pages
+        _mapping = CreateFileMapping(_file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (_mapping == NULL) {
+            release();
+            THROW_IE_EXCEPTION << "Cannot create mapping for file " << path << ": " << GetLastError();
+        }
+        _data = static_cast<char*>(MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, 0));
+        if (_data == nullptr) {
+            release();
+            THROW_IE_EXCEPTION << "Cannot map file " << path << ": " << GetLastError();
+        }
+    }
+
+public:
+    explicit WindowsMappedMemory(const std::string& path) {
+        _file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        map(path);
+    }
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+    explicit WindowsMappedMemory(const std::wstring& path) {
+        _file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        map(FileUtils::wStringtoMBCSstringChar(path));
+    }
+#endif
+
+    ~WindowsMappedMemory() override {
+        release();
+    }
+
+    char* data() noexcept override {
+        return _data;
+    }
+
+    size_t size() const noexcept override {
+        return _size;
+    }
+};
+
+MappedMemory::Ptr load_mmap_object(const std::string& path) {
+    return std::make_shared<WindowsMappedMemory>(path);
+}
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+MappedMemory::Ptr load_mmap_object(const std::wstring& path) {
+    return std::make_shared<WindowsMappedMemory>(path);
+}
+#endif
+
+}  // namespace InferenceEngine
@@ -9,6 +9,8 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
+#include <array>
 #include <atomic>
 #include <climits>
 #include <cassert>
@@ -26,6 +28,8 @@ using namespace openvino;
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
+    static constexpr std::size_t PriorityNum = IStreamsExecutor::TaskPriority::BULK + 1;
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer: public tbb::task_scheduler_observer {
@@ -155,6 +159,10 @@ struct CPUStreamsExecutor::Impl {
                                       static_cast<std::size_t>(_config._streams)),
                              numaNodes.size()),
                     std::back_inserter(_usedNumaNodes));
+        _workerQueues.reserve(_config._streams);
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _workerQueues.emplace_back(new WorkerQueue);
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 itt::threadName(_config._name + "_" + std::to_string(streamId));
@@ -162,28 +170,89 @@ struct CPUStreamsExecutor::Impl {
                     Task task;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        _queueCondVar.wait(lock, [&] { return (_pendingTasks != 0) || (stopped = _isStopped); });
+                        if (_pendingTasks != 0) {
+                            // reserve one of the pending tasks for this worker
+                            --_pendingTasks;
+                        } else {
+                            continue;
                         }
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                    while (!(task = Pop(streamId))) {
+                        std::this_thread::yield();
                     }
+                    Execute(task, *(_streams.local()));
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
+    /**
+     * @brief Per worker queues. Each worker takes tasks from its own queue first
+     *        and steals from the queues of other workers when its queue is empty.
+     */
+    struct WorkerQueue {
+        std::mutex                                  _mutex;
+        std::array<std::deque<Task>, PriorityNum>   _tasks;
+    };
+
+    int CurrentWorkerId() const {
+        const auto threadId = std::this_thread::get_id();
+        for (std::size_t workerId = 0; workerId < _threads.size(); ++workerId) {
+            if (_threads[workerId].get_id() == threadId) {
+                return static_cast<int>(workerId);
+            }
+        }
+        return -1;
+    }
+
+    void Enqueue(Task task, IStreamsExecutor::TaskPriority priority) {
+        // tasks submitted from a worker are kept local to it, external tasks are distributed round robin
+        auto workerId = CurrentWorkerId();
+        if (workerId < 0) {
+            workerId = static_cast<int>(_nextWorkerQueue++ % _workerQueues.size());
+        }
+        {
+            auto& queue = *_workerQueues[workerId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks[priority].emplace_back(std::move(task));
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            ++_pendingTasks;
         }
         _queueCondVar.notify_one();
     }
 
+    Task Pop(const int workerId) {
+        // Higher priority class is taken from any queue before lower one is considered,
+        // so latency critical tasks never wait behind bulk ones
+        const auto workersNum = static_cast<int>(_workerQueues.size());
+        for (std::size_t priority = 0; priority < PriorityNum; ++priority) {
+            {
+                auto& queue = *_workerQueues[workerId];
+                std::lock_guard<std::mutex> lock(queue._mutex);
+                auto& tasks = queue._tasks[priority];
+                if (!tasks.empty()) {
+                    Task task = std::move(tasks.front());
+                    tasks.pop_front();
+                    return task;
+                }
+            }
+            for (int i = 1; i < workersNum; ++i) {
+                auto& victim = *_workerQueues[(workerId + i) % workersNum];
+                std::lock_guard<std::mutex> lock(victim._mutex);
+                auto& tasks = victim._tasks[priority];
+                if (!tasks.empty()) {
+                    Task task = std::move(tasks.back());
+                    tasks.pop_back();
+                    return task;
+                }
+            }
+        }
+        return {};
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -219,7 +288,9 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::atomic<std::size_t>                _nextWorkerQueue = {0};
+    std::size_t                             _pendingTasks = 0;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -258,10 +329,14 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run(std::move(task), TaskPriority::NORMAL);
+}
+
+void CPUStreamsExecutor::run(Task task, TaskPriority priority) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
@@ -18,6 +18,10 @@
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::run(Task task, TaskPriority) {
+    run(std::move(task));
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
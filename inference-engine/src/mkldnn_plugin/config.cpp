@@ -81,6 +81,19 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL) {
+            if (val == PluginConfigParams::YES) interOpParallel = true;
+            else if (val == PluginConfigParams::NO) interOpParallel = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_STREAMS_TASK_PRIORITY) {
+            if (val == PluginConfigInternalParams::REALTIME) taskPriority = IStreamsExecutor::TaskPriority::REALTIME;
+            else if (val == PluginConfigInternalParams::NORMAL) taskPriority = IStreamsExecutor::TaskPriority::NORMAL;
+            else if (val == PluginConfigInternalParams::BULK) taskPriority = IStreamsExecutor::TaskPriority::BULK;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_STREAMS_TASK_PRIORITY
+                                   << ". Expected only REALTIME / NORMAL / BULK";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -7,8 +7,33 @@
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {}
+                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                               const InferenceEngine::ITaskExecutor::Ptr& preprocExecutor)
+        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+          _inferRequest(std::dynamic_pointer_cast<MKLDNNInferRequest>(inferRequest)) {
+    if (preprocExecutor != nullptr && _inferRequest != nullptr) {
+        // Graph memory is thread local, so only pre-processing into request owned blobs can leave the stream
+        _pipeline = {
+            {preprocExecutor, [this] {
+                _inferRequest->PreprocessInputs(true);
+            }},
+            {taskExecutor, [this] {
+                _inferRequest->InferGraph();
+            }}
+        };
+        _hasPreprocStage = true;
+    }
+}
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    if (_hasPreprocStage && !_inferRequest->IsPreprocessingRequired()) {
+        // Nothing to prepare, so skip the thread hop to the pre-processing executor
+        _inferRequest->checkBlobs();
+        RunFirstStage(std::next(_pipeline.begin()), _pipeline.end(), _callbackExecutor);
+    } else {
+        InferenceEngine::AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+    }
+}
 
 void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include "mkldnn_infer_request.h"
 
@@ -13,13 +14,25 @@ namespace MKLDNNPlugin {
 
 class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
+    /**
+     * @param preprocExecutor If not null, input pre-processing is run as a separate pipeline stage on this executor,
+     *        so it overlaps with inference of other requests on the stream executor
+     */
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const InferenceEngine::ITaskExecutor::Ptr &preprocExecutor = nullptr);
 
     void Infer_ThreadUnsafe() override;
 
     ~MKLDNNAsyncInferRequest() override;
+
+protected:
+    void StartAsync_ThreadUnsafe() override;
+
+private:
+    std::shared_ptr<MKLDNNInferRequest> _inferRequest;
+    bool                                _hasPreprocStage = false;
 };
 
 }  // namespace MKLDNNPlugin
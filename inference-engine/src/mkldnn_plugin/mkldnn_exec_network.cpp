@@ -11,6 +11,7 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 #include "bf16transformer.h"
 #include <ie_util_internal.hpp>
 #include <graph_tools.hpp>
@@ -23,6 +24,8 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <pugixml.hpp>
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
@@ -40,7 +43,8 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     bool isImported) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
@@ -50,7 +54,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     // we are cloning network if we have statistics and we can transform network.
     _clonedNetwork = cloneNet(network);
 
-    if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+    // imported network already contains the result of low precision and BF16 transformations
+    if (!isImported && _cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         auto params = LayerTransformation::Params(true,  // updatePrecisions
                                                     true,  // quantizeOutputs
                                                     true,  // weightsToConst
@@ -118,7 +123,18 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                                                 ? std::max(1, threads/streamExecutorConfig._streams)
                                                 : threads;
         streamExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamExecutorConfig);
+        auto streamsExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamExecutorConfig);
+        _taskExecutor = streamsExecutor;
+        // the priority is attached to each inference task, so requests submitted after a priority change
+        // overtake already queued ones in the same streams
+        _priorityExecutor = std::make_shared<PriorityExecutor>(streamsExecutor, cfg.taskPriority);
+        _inferExecutor = _priorityExecutor;
+        if (streamExecutorConfig._streams > 1) {
+            // throughput mode: pre-processing of next requests overlaps with inference of current ones
+            _preprocExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+                IStreamsExecutor::Config{"CPUPreprocessingExecutor", streamExecutorConfig._streams, 1,
+                                         IStreamsExecutor::ThreadBindingType::NONE});
+        }
     }
     if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
@@ -126,6 +142,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (nullptr == _inferExecutor) {
+        _inferExecutor = _taskExecutor;
+    }
 
     _graphs = decltype(_graphs){[&] {
         // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
@@ -141,6 +160,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         if (nullptr != streamExecutor) {
             numaNode = streamExecutor->GetNumaNodeId();
         }
+        graph->setNumaNode(numaNode);
         graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
         return graph;
     }};
@@ -180,7 +200,8 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _inferExecutor, _callbackExecutor,
+                                                                      _preprocExecutor);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
@@ -194,6 +215,23 @@ void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &grap
     graphPtr = _graphs.begin()->get()->dump();
 }
 
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config, ResponseDesc *resp) {
+    if (config.empty()) {
+        THROW_IE_EXCEPTION << "The list of configuration values is empty";
+    }
+    for (auto&& item : config) {
+        if (item.first != PluginConfigInternalParams::KEY_CPU_STREAMS_TASK_PRIORITY || nullptr == _priorityExecutor) {
+            THROW_IE_EXCEPTION << "The following config value cannot be changed dynamically for ExecutableNetwork: "
+                               << item.first;
+        }
+    }
+    std::lock_guard<std::mutex> lock{_cfgMutex};
+    for (auto&& item : config) {
+        _cfg.readProperties({{item.first, item.second.as<std::string>()}});
+    }
+    _priorityExecutor->SetPriority(_cfg.taskPriority);
+}
+
 void MKLDNNExecNetwork::GetConfig(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -220,6 +258,8 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(NUMA_NODES_MEMORY_PLACEMENT));
+        metrics.push_back(METRIC_KEY(OUTPUTS_ZERO_COPY));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -234,6 +274,23 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto streams = std::stoi(option->second);
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(NUMA_NODES_MEMORY_PLACEMENT)) {
+        std::map<int, uint64_t> placement;
+        std::unordered_set<const void*> visited;
+        for (auto&& graph : _graphs) {
+            graph->GetMemoryPlacement(placement, visited);
+        }
+        result = IE_SET_METRIC(NUMA_NODES_MEMORY_PLACEMENT, placement);
+    } else if (name == METRIC_KEY(OUTPUTS_ZERO_COPY)) {
+        std::map<std::string, MKLDNNGraph::OutputCopyStats> stats;
+        for (auto&& graph : _graphs) {
+            graph->GetOutputCopyStats(stats);
+        }
+        std::map<std::string, bool> zeroCopy;
+        for (auto&& output : stats) {
+            zeroCopy[output.first] = output.second.copied == 0 && output.second.zeroCopy != 0;
+        }
+        result = IE_SET_METRIC(OUTPUTS_ZERO_COPY, zeroCopy);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -298,3 +355,71 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &n
 std::vector<IMemoryStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
     return memoryStates;
 }
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+    AssertIRv7ReaderExists();
+
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    cpuNode.append_attribute("name").set_value(_name.c_str());
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& networkInput : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(networkInput.first.c_str());
+        inputNode.append_attribute("precision").set_value(networkInput.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(networkInput.second->getLayout()));
+
+        auto& preProcess = networkInput.second->getPreProcess();
+        inputNode.append_attribute("resize").set_value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        inputNode.append_attribute("color").set_value(static_cast<int>(preProcess.getColorFormat()));
+        if (preProcess.getLetterbox()) {
+            inputNode.append_attribute("letterbox").set_value(true);
+            inputNode.append_attribute("pad_value").set_value(preProcess.getPadValue());
+        }
+        if (preProcess.getMeanVariant() == MEAN_IMAGE) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of networks with mean image is not supported";
+        }
+        if (preProcess.getMeanVariant() == MEAN_VALUE) {
+            for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+                auto channelNode = inputNode.append_child("channel");
+                channelNode.append_attribute("mean").set_value(preProcess[c]->meanValue);
+                channelNode.append_attribute("scale").set_value(preProcess[c]->stdScale);
+            }
+        }
+    }
+
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& networkOutput : _networkOutputs) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(networkOutput.first.c_str());
+        outputNode.append_attribute("precision").set_value(networkOutput.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(networkOutput.second->getLayout()));
+
+        // output data names of the transformed network may not follow legacy IR naming rules
+        auto outData = _clonedNetwork->getData(networkOutput.first);
+        IE_ASSERT(nullptr != outData);
+        auto creator = getCreatorLayer(outData).lock();
+        auto& outDatas = creator->outData;
+        auto itData = std::find(std::begin(outDatas), std::end(outDatas), outData);
+        IE_ASSERT(outDatas.end() != itData);
+        outputNode.append_attribute("creatorName").set_value(creator->name.c_str());
+        outputNode.append_attribute("index").set_value(std::to_string(std::distance(std::begin(outDatas), itData)).c_str());
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    SerializeNetwork(networkModel, *_clonedNetwork);
+}
@@ -9,6 +9,7 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
+#include <threading/ie_priority_executor.hpp>
 
 #include <vector>
 #include <memory>
@@ -30,12 +31,15 @@ public:
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      bool isImported = false);
 
     ~MKLDNNExecNetwork() override = default;
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config, InferenceEngine::ResponseDesc *resp) override;
+
     void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
 
     void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
@@ -44,6 +48,8 @@ public:
 
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
+    void ExportImpl(std::ostream& networkModel) override;
+
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
 protected:
@@ -55,6 +61,9 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    InferenceEngine::ITaskExecutor::Ptr         _preprocExecutor;
+    InferenceEngine::ITaskExecutor::Ptr         _inferExecutor;
+    InferenceEngine::PriorityExecutor::Ptr      _priorityExecutor;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
@@ -20,6 +20,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
 #include "mkldnn_itt.h"
+#include "utils/numa_utils.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 
@@ -29,6 +30,7 @@
 #include <net_pass.h>
 #include <details/ie_cnn_network_tools.h>
 #include <ie_memcpy.h>
+#include <ie_parallel.hpp>
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
@@ -91,8 +93,8 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         MKLDNNWeightsSharing::Ptr &w_cache) {
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // weights are cached for single stream too, to share them with other networks
+    weightsCache = w_cache;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -322,18 +324,135 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
         auto inputLayer = getCreatorLayer(input.second->getInputData()).lock();
         inputNodes[input.first] = layer2node[inputLayer];
 
-        // Loading mean images
-        MKLDNNDims outDims;
-        if (!inputNodes[input.first]->getChildEdgeAt(0)->getDims().ndims())
-            outDims = MKLDNNDims(InferenceEngine::SizeVector(1, 1));
-        else
-            outDims = MKLDNNDims(inputNodes[input.first]->getChildEdgeAt(0)->getDims());
-        if (inputs.find(input.first) != inputs.end()) {
-            InputInfo::Ptr ii = inputs[input.first];
-            if (ii && ii->getPreProcess().getNumberOfChannels()) {
-                _meanImages[input.first].Load(outDims, ii);
+        if (input.second && input.second->getPreProcess().getNumberOfChannels()) {
+            AddInputPreprocessing(input.first, input.second, extMgr);
+        }
+    }
+}
+
+void MKLDNNGraph::AddInputPreprocessing(const std::string& name, const InputInfo::Ptr& inputInfo,
+                                        const MKLDNNExtensionManager::Ptr& extMgr) {
+    const PreProcessInfo& pp = inputInfo->getPreProcess();
+    const size_t channels = pp.getNumberOfChannels();
+
+    bool withScale = false;
+    for (size_t c = 0; c < channels; c++) {
+        withScale |= pp[c]->stdScale != 1.0f;
+    }
+    if (pp.getMeanVariant() == NONE && !withScale)
+        return;
+    if (pp.getMeanVariant() != NONE && pp.getMeanVariant() != MEAN_VALUE && pp.getMeanVariant() != MEAN_IMAGE)
+        THROW_IE_EXCEPTION << "Unsupported mean variant: " << pp.getMeanVariant();
+
+    const DataPtr inputData = inputInfo->getInputData();
+    const SizeVector dims = inputData->getTensorDesc().getDims();
+    if (dims.size() < 2 || dims[1] != channels) {
+        THROW_IE_EXCEPTION << "channels mismatch between mean and input";
+    }
+
+    // Preprocessing is computed in FP32, so the input keeps its own precision and the graph inserts a converting reorder
+    auto createFloatData = [&](const std::string& dataName, const SizeVector& dataDims) {
+        return std::make_shared<Data>(dataName, TensorDesc(Precision::FP32, dataDims, TensorDesc::getLayoutByDims(dataDims)));
+    };
+    auto createFloatBlob = [&](const SizeVector& blobDims) {
+        auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, blobDims, TensorDesc::getLayoutByDims(blobDims)));
+        blob->allocate();
+        return blob;
+    };
+
+    auto inputNode = inputNodes[name];
+    std::vector<MKLDNNEdgePtr> consumers;
+    for (size_t i = 0; i < inputNode->getChildEdges().size(); i++) {
+        consumers.push_back(inputNode->getChildEdgeAt(i));
+    }
+
+    MKLDNNNodePtr lastNode = inputNode;
+    DataPtr lastData = inputData;
+    auto appendLayer = [&](const CNNLayerPtr& layer, const std::vector<MKLDNNNodePtr>& extraParents) {
+        const MKLDNNNodePtr node(MKLDNNNode::CreateNode(layer, getEngine(), extMgr, weightsCache));
+        MKLDNNEdgePtr edge(new MKLDNNEdge(lastNode, node, 0, 0));
+        node->addEdge(edge);
+        graphEdges.push_back(edge);
+        for (size_t i = 0; i < extraParents.size(); i++) {
+            MKLDNNEdgePtr extraEdge(new MKLDNNEdge(extraParents[i], node, 0, static_cast<int>(i + 1)));
+            node->addEdge(extraEdge);
+            graphEdges.push_back(extraEdge);
+        }
+        graphNodes.push_back(node);
+        lastNode = node;
+        lastData = layer->outData[0];
+    };
+
+    if (pp.getMeanVariant() == MEAN_IMAGE) {
+        if (dims.size() != 4) {
+            THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+        }
+        const size_t height = dims[2];
+        const size_t width = dims[3];
+
+        // Mean image is stored negated, so it is added to the input by broadcasting Eltwise
+        auto meanBlob = createFloatBlob({1, channels, height, width});
+        float* meanData = meanBlob->data();
+        for (size_t c = 0; c < channels; c++) {
+            Blob::Ptr channelMean = pp[c]->meanData;
+            if (!channelMean || channelMean->getTensorDesc().getPrecision() != Precision::FP32)
+                THROW_IE_EXCEPTION << "mean image not provided or not in Float 32";
+            if (channelMean->size() != height * width) {
+                THROW_IE_EXCEPTION << "mean image size does not match expected network input, expecting " << width << " x " << height;
+            }
+            const float* channelData = channelMean->cbuffer().as<const float*>();
+            for (size_t i = 0; i < height * width; i++) {
+                meanData[c * height * width + i] = -channelData[i];
             }
         }
+
+        CNNLayerPtr constLayer(new CNNLayer({name + "_mean_image", "Const", Precision::FP32}));
+        constLayer->blobs["custom"] = meanBlob;
+        constLayer->outData.push_back(createFloatData(constLayer->name, meanBlob->getTensorDesc().getDims()));
+        getCreatorLayer(constLayer->outData[0]) = constLayer;
+        const MKLDNNNodePtr constNode(MKLDNNNode::CreateNode(constLayer, getEngine(), extMgr, weightsCache));
+        graphNodes.push_back(constNode);
+
+        auto eltwiseLayer = std::make_shared<EltwiseLayer>(LayerParams{name + "_mean", "Eltwise", Precision::FP32});
+        eltwiseLayer->_operation = EltwiseLayer::Sum;
+        eltwiseLayer->insData.push_back(lastData);
+        eltwiseLayer->insData.push_back(constLayer->outData[0]);
+        eltwiseLayer->outData.push_back(createFloatData(eltwiseLayer->name, dims));
+        getCreatorLayer(eltwiseLayer->outData[0]) = eltwiseLayer;
+        appendLayer(eltwiseLayer, {constNode});
+    }
+
+    if (pp.getMeanVariant() == MEAN_VALUE || withScale) {
+        // (x - mean) * scale per channel as ScaleShift, so it may be folded into the first convolution
+        auto scales = createFloatBlob({channels});
+        auto shifts = createFloatBlob({channels});
+        for (size_t c = 0; c < channels; c++) {
+            const float mean = pp.getMeanVariant() == MEAN_VALUE ? pp[c]->meanValue : 0.0f;
+            scales->data()[c] = pp[c]->stdScale;
+            shifts->data()[c] = -mean * pp[c]->stdScale;
+        }
+
+        auto scaleShiftLayer = std::make_shared<ScaleShiftLayer>(LayerParams{name + "_mean_values", "ScaleShift", Precision::FP32});
+        scaleShiftLayer->_weights = scales;
+        scaleShiftLayer->_biases = shifts;
+        scaleShiftLayer->blobs["weights"] = scales;
+        scaleShiftLayer->blobs["biases"] = shifts;
+        scaleShiftLayer->insData.push_back(lastData);
+        scaleShiftLayer->outData.push_back(createFloatData(scaleShiftLayer->name, dims));
+        getCreatorLayer(scaleShiftLayer->outData[0]) = scaleShiftLayer;
+        appendLayer(scaleShiftLayer, {});
+    }
+
+    // Reconnect former consumers of the input to the end of preprocessing chain
+    for (auto& edge : consumers) {
+        auto child = edge->getChild();
+        const int childPort = edge->getOutputNum();
+        edge->drop();
+        graphEdges.erase(std::remove(graphEdges.begin(), graphEdges.end(), edge), graphEdges.end());
+
+        MKLDNNEdgePtr newEdge(new MKLDNNEdge(lastNode, child, 0, childPort));
+        lastNode->addEdge(newEdge);
+        graphEdges.push_back(newEdge);
     }
 }
 
@@ -356,10 +475,14 @@ void MKLDNNGraph::InitGraph() {
 
     SortTopologically();
 
+    InitExecLevels();
+
     Allocate();
 
     CreatePrimitives();
 
+    BindWeightsToNumaNode();
+
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
         auto nodeType = graphNode->getType();
@@ -421,20 +544,45 @@ void MKLDNNGraph::InitNodes() {
     }
 }
 
-void MKLDNNGraph::InitDescriptors() {
+void MKLDNNGraph::ParallelForEachNode(const std::function<void(const MKLDNNNodePtr&)>& func) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // Edge dims and node constness are cached on first access, so they are resolved before nodes are visited concurrently
+    for (auto &edge : graphEdges) {
+        edge->getDims();
+    }
     for (auto &node : graphNodes) {
-#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
-        if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
-            auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
-            if (inputNode)
-                inputNode->withMeanImage();
+        node->isConstant();
+    }
+
+    // Extension and memory nodes may rely on the calling thread, so only built-in stateless nodes are processed in parallel
+    std::vector<MKLDNNNodePtr> parallelNodes;
+    for (auto &node : graphNodes) {
+        const auto type = node->getType();
+        if (type == Generic || type == MemoryInput || type == MemoryOutput || type == TensorIterator) {
+            func(node);
+        } else {
+            parallelNodes.push_back(node);
         }
+    }
+    parallel_for(parallelNodes.size(), [&](size_t i) {
+        func(parallelNodes[i]);
+    });
+#else
+    // Primitives created inside an OpenMP parallel region would be tuned for a single thread, so nodes are processed serially
+    for (auto &node : graphNodes) {
+        func(node);
+    }
 #endif
+}
+
+void MKLDNNGraph::InitDescriptors() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitDescriptors");
+    ParallelForEachNode([](const MKLDNNNodePtr& node) {
         node->getSupportedDescriptors();
 
         node->initSupportedPrimitiveDescriptors();
         node->filterSupportedPrimitiveDescriptors();
-    }
+    });
 
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
@@ -526,6 +674,83 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+// Size in bytes from the beginning of edge memory to its last element
+static int64_t getEdgeMemorySize(const MKLDNNEdgePtr &edge) {
+    const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
+
+    int64_t e_size = block_desk.getOffsetPadding() + 1;
+    for (int j = 0; j < block_desk.getBlockDims().size(); j++)
+        e_size += (block_desk.getBlockDims()[j] - 1) * block_desk.getStrides()[j];
+
+    // In some cases computational formula above doesn't work properly (e.g. for OhIw8o4i layout).
+    // This WA allows to limit the size of allocated memory from below.
+    // TODO: need to properly investigate the root cause of incorrect computations
+    int64_t min_size = 1;
+    for (int64_t dim : block_desk.getBlockDims()) {
+        min_size *= dim;
+    }
+    e_size = std::max(e_size, min_size);
+
+    return e_size * (edge->getDesc().getPrecision() == Precision::BIN ? 1 : edge->getDesc().getPrecision().size());
+}
+
+// Output memory may be taken from a user buffer if the whole cluster of views fits into the output tensor
+// and none of its nodes keeps data between inferences or binds memory pointers by itself
+static bool isOutputClusterBindable(const std::vector<MKLDNNEdgePtr> &claster, const MKLDNNEdgePtr &outEdge) {
+    if (outEdge->getDesc().getBlockingDesc().getOffsetPadding() != 0)
+        return false;
+    const int64_t outSize = getEdgeMemorySize(outEdge);
+    for (auto &edge : claster) {
+        if (edge != outEdge && edge->getChild()->getType() == Output)
+            return false;
+        if (isConstOutput(edge) || edge->getParent()->isConstant())
+            return false;
+        for (auto &node : {edge->getParent(), edge->getChild()}) {
+            auto type = node->getType();
+            if (type == Input || type == MemoryInput || type == MemoryOutput || type == Generic || type == TensorIterator)
+                return false;
+        }
+        if (getEdgeMemorySize(edge) > outSize)
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGraph::InitExecLevels() {
+    execLevels.clear();
+    interOpParallel = false;
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    if (!config.interOpParallel)
+        return;
+
+    // Memory nodes pass data to each other without edges, so their order can not be relaxed
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    // Level of a node is the length of the longest path from graph inputs to it.
+    // Nodes of the same level do not depend on each other and can be executed concurrently.
+    std::vector<size_t> nodeLevels(graphNodes.size(), 0);
+    for (auto &node : graphNodes) {
+        size_t level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            level = std::max(level, nodeLevels[parent->execIndex] + 1);
+        }
+        nodeLevels[node->execIndex] = level;
+        if (execLevels.size() <= level)
+            execLevels.resize(level + 1);
+        execLevels[level].push_back(node);
+    }
+
+    // There is nothing to execute in parallel for linear topologies
+    interOpParallel = execLevels.size() < graphNodes.size();
+    if (!interOpParallel)
+        execLevels.clear();
+#endif
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
 
@@ -596,30 +821,25 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // In inter-op parallel mode nodes of one execution level work simultaneously,
+    // so lifetimes of tensors are measured in levels rather than in node indexes
+    std::unordered_map<MKLDNNNode*, int> execStamps;
+    for (auto &node : graphNodes)
+        execStamps[node.get()] = node->execIndex;
+    for (size_t level = 0; level < execLevels.size(); level++) {
+        for (auto &node : execLevels[level])
+            execStamps[node.get()] = static_cast<int>(level);
+    }
+
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
-
-            const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
-
-            int64_t e_size = block_desk.getOffsetPadding() + 1;  // size in bytes (from begin of data to last element)
-            for (int j = 0; j < block_desk.getBlockDims().size(); j++)
-                e_size += (block_desk.getBlockDims()[j] - 1) * block_desk.getStrides()[j];
-
-            // In some cases computational formula above doesn't work properly (e.g. for OhIw8o4i layout).
-            // This WA allows to limit the size of allocated memory from below.
-            // TODO: need to properly investigate the root cause of incorrect computations
-            int64_t min_size = 1;
-            for (int64_t dim : block_desk.getBlockDims()) {
-                min_size *= dim;
-            }
-            e_size = std::max(e_size, min_size);
+            int e_start = execStamps[edge->getParent().get()];
+            int e_finish = execStamps[edge->getChild().get()];
 
-            e_size *= edge->getDesc().getPrecision() == Precision::BIN ? 1 : edge->getDesc().getPrecision().size();
+            int64_t e_size = getEdgeMemorySize(edge);
 
             box.start = std::min(e_start, box.start);
             box.finish = std::max(e_finish, box.finish);
@@ -640,6 +860,19 @@ void MKLDNNGraph::AllocateWithReuse() {
             isConst |= edge->getParent()->getType() == MemoryInput;
         }
 
+        for (auto &edge : edge_clasters[i]) {
+            if (edge->getChild()->getType() != Output)
+                continue;
+            auto &binding = outputBindings[edge->getChild()->getName().substr(4)];
+            if (isOutputClusterBindable(edge_clasters[i], edge)) {
+                binding.edges = {edge};
+                for (auto &view : edge_clasters[i]) {
+                    if (view != edge)
+                        binding.edges.push_back(view);
+                }
+            }
+        }
+
         if (reuse_io_tensors) {
             if (isInput | isConst) box.start = 0;
             if (isOutput | isConst) box.finish = -1;
@@ -656,8 +889,12 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
+    // Memory policy is set on a fresh mapping before any page is touched, so activations of the stream
+    // are local for its threads. Otherwise the workspace is allocated by MKLDNN
+    memWorkspace.reset();
+    workspaceBuffer = AllocateOnNumaNode(total_size, numaNodeId);
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)), workspaceBuffer.get());
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
     for (int i = 0; i < edge_clasters.size(); i++) {
@@ -696,12 +933,51 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    for (auto& binding : outputBindings) {
+        auto& edges = binding.second.edges;
+        if (edges.empty())
+            continue;
+        binding.second.defaultPtr = edges[0]->getMemory().GetData();
+        // Views are rebound by data handle, so all of them have to share the handle of the output memory
+        for (auto& edge : edges) {
+            if (edge->getMemory().GetData() != binding.second.defaultPtr) {
+                edges.clear();
+                break;
+            }
+        }
+    }
 }
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // Edges are allocated and validated at this point, so primitives of different nodes do not depend on each other
+    ParallelForEachNode([](const MKLDNNNodePtr& node) {
         node->createPrimitive();
+    });
+}
+
+void MKLDNNGraph::BindWeightsToNumaNode() {
+    // Weights were written by the thread which created the graph, so pages are migrated if needed.
+    // Weights shared between streams of one NUMA node are bound to the same node.
+    for (auto& node : graphNodes) {
+        for (auto& memory : node->internalBlobMemory) {
+            if (memory)
+                BindToNumaNode(memory->GetData(), memory->GetSize(), numaNodeId);
+        }
+    }
+}
+
+void MKLDNNGraph::GetMemoryPlacement(std::map<int, uint64_t>& placement, std::unordered_set<const void*>& visited) const {
+    auto collect = [&] (const MKLDNNMemoryPtr& memory) {
+        if (!memory || !visited.insert(memory->GetData()).second)
+            return;
+        GetNumaPlacement(memory->GetData(), memory->GetSize(), placement);
+    };
+    collect(memWorkspace);
+    for (auto& node : graphNodes) {
+        for (auto& memory : node->internalBlobMemory)
+            collect(memory);
     }
 }
 
@@ -710,8 +986,6 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
 
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
-        MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
-
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
@@ -724,15 +998,6 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
                     MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
                     MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
         }
-
-        // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
-            } else {
-                THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
-            }
-        }
     } else {
         THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
     }
@@ -769,8 +1034,15 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         void *ext_blob_ptr = ext_blob->buffer();
         void *intr_blob_ptr = intr_blob.GetData();
 
+        auto binding = outputBindings.find(name);
         // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        if (ext_blob_ptr == intr_blob_ptr) {
+            if (binding != outputBindings.end())
+                binding->second.zeroCopy++;
+            continue;
+        }
+        if (binding != outputBindings.end())
+            binding->second.copied++;
 
         int MB = intr_blob.GetDims()[0];
         int MB_to_process = node->batchToProcess();
@@ -783,26 +1055,75 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
-void MKLDNNGraph::Infer(int batch) {
-    if (!IsReady()) {
-        THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
+bool MKLDNNGraph::IsOutputBindable(const std::string& name, const TensorDesc& desc) const {
+    auto binding = outputBindings.find(name);
+    if (binding == outputBindings.end() || binding->second.edges.empty())
+        return false;
+    const auto& outEdge = binding->second.edges[0];
+    const TensorDesc outDesc = outEdge->getDesc();
+    return desc.getPrecision() == outDesc.getPrecision() &&
+           desc.getDims() == outEdge->getDims().ToSizeVector() &&
+           desc.getBlockingDesc() == outDesc.getBlockingDesc();
+}
+
+bool MKLDNNGraph::BindOutputMemory(const std::string& name, void* ptr) {
+    auto binding = outputBindings.find(name);
+    if (binding == outputBindings.end() || binding->second.edges.empty())
+        return false;
+    if (ptr == nullptr)
+        ptr = binding->second.defaultPtr;
+    if (binding->second.edges[0]->getMemory().GetData() == ptr)
+        return true;
+    // Views on the output memory keep the same data handle and address their part by offset in the descriptor
+    for (auto& edge : binding->second.edges) {
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(ptr);
     }
+    return true;
+}
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+void MKLDNNGraph::GetOutputCopyStats(std::map<std::string, OutputCopyStats>& stats) const {
+    for (auto& binding : outputBindings) {
+        auto& outStats = stats[binding.first];
+        outStats.copied += binding.second.copied;
+        outStats.zeroCopy += binding.second.zeroCopy;
+    }
+}
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch) {
+    PERF(node);
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profilingTask);
-            graphNodes[i]->execute(stream);
-        }
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profilingTask);
+        node->execute(stream);
+    }
+
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
+}
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+void MKLDNNGraph::Infer(int batch) {
+    if (!IsReady()) {
+        THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
+    }
+
+    if (interOpParallel) {
+        // Levels are executed one by one, nodes inside a level run in parallel
+        // within the arena of the current stream and keep their own intra-op parallelism
+        for (auto &level : execLevels) {
+            parallel_for(level.size(), [&](size_t i) {
+                mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+                ExecuteNode(level[i], stream, batch);
+            });
+        }
+    } else {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (int i = 0; i < graphNodes.size(); i++) {
+            ExecuteNode(graphNodes[i], stream, batch);
+        }
     }
 
     if (infer_count != -1) infer_count++;
@@ -8,14 +8,16 @@
 #include "ie_icnn_network.hpp"
 #include "config.h"
 #include "mkldnn_memory.h"
-#include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "threading/ie_thread_local.hpp"
+#include <atomic>
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
+#include <functional>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 
@@ -39,6 +41,10 @@ public:
         return (GetStatus() == Ready);
     }
 
+    void setNumaNode(int numaNode) {
+        numaNodeId = numaNode;
+    }
+
     void setConfig(const Config &cfg);
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
@@ -51,10 +57,6 @@ public:
                      const MKLDNNExtensionManager::Ptr& extMgr,
                      MKLDNNWeightsSharing::Ptr &w_cache);
 
-    bool hasMeanImageFor(const std::string& name) {
-        return _meanImages.find(name) != _meanImages.end();
-    }
-
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
@@ -90,8 +92,37 @@ public:
 
     void ResetInferCount() { infer_count = 0; }
 
+    /**
+     * Accumulates amount of graph memory (activations and weights) resident on each NUMA node.
+     * Buffers which are already in visited set are skipped, so shared weights are counted once.
+     */
+    void GetMemoryPlacement(std::map<int, uint64_t>& placement, std::unordered_set<const void*>& visited) const;
+
     void SortTopologically();
 
+    /**
+     * Checks whether a user buffer with the given descriptor may replace memory of the output, so inference
+     * writes the output directly into it and PullOutputData does not copy.
+     */
+    bool IsOutputBindable(const std::string& name, const InferenceEngine::TensorDesc& desc) const;
+
+    /**
+     * Redirects memory of the output and of all in-place views on it (e.g. inputs of optimized concat)
+     * to the external buffer. nullptr restores memory owned by the graph.
+     * @return false if the output memory can not be replaced
+     */
+    bool BindOutputMemory(const std::string& name, void* ptr);
+
+    struct OutputCopyStats {
+        uint64_t copied = 0;
+        uint64_t zeroCopy = 0;
+    };
+
+    /**
+     * Accumulates number of PullOutputData calls which copied each output and which found it already in place
+     */
+    void GetOutputCopyStats(std::map<std::string, OutputCopyStats>& stats) const;
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -103,7 +134,9 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
-        _meanImages.clear();
+        execLevels.clear();
+        interOpParallel = false;
+        outputBindings.clear();
     }
     Status status;
     Config config;
@@ -114,27 +147,55 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    // NUMA node of the stream which owns the graph, -1 if unknown
+    int numaNodeId = -1;
+
+    // NUMA local buffer of the workspace if it's allocated by the graph, must outlive memWorkspace
+    std::shared_ptr<void> workspaceBuffer;
     MKLDNNMemoryPtr memWorkspace;
 
+    // Inter-op parallel execution: nodes grouped by the longest path from inputs
+    bool interOpParallel = false;
+    std::vector<std::vector<MKLDNNNodePtr>> execLevels;
+
+    struct OutputBinding {
+        // Output edge goes first, followed by the edges which are views on its memory.
+        // Empty if the output memory can not be replaced by a user buffer
+        std::vector<MKLDNNEdgePtr> edges;
+        void* defaultPtr = nullptr;
+        std::atomic<uint64_t> copied{0};
+        std::atomic<uint64_t> zeroCopy{0};
+    };
+    std::map<std::string, OutputBinding> outputBindings;
+
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
-    std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
     mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const InferenceEngine::TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
+    /**
+     * Inserts mean and scale from input PreProcessInfo as graph nodes after the input node, so they are
+     * computed by the graph instead of a separate pass over the input blob on every inference.
+     */
+    void AddInputPreprocessing(const std::string& name, const InferenceEngine::InputInfo::Ptr& inputInfo,
+                               const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void ParallelForEachNode(const std::function<void(const MKLDNNNodePtr&)>& func);
     void InitEdges();
+    void InitExecLevels();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void BindWeightsToNumaNode();
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -48,6 +48,11 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     MergeTwoEqualScaleShifts(graph);
     graph.RemoveDroppedNodes();
 
+#if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
+    FuseInputScaleShiftAndConvolution(graph);
+    graph.RemoveDroppedNodes();
+#endif
+
     MergeSigmoidAndMultiplyToSwish(graph);
     graph.RemoveDroppedNodes();
 
@@ -926,6 +931,112 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDepthwise(MKLDNNGraph &graph) {
         graph.DropNode(depthwise0);
     }
 }
+
+void MKLDNNGraphOptimizer::FuseInputScaleShiftAndConvolution(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableScaleShiftNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Depthwise || node->getCnnLayer()->type != "ScaleShift")
+            return false;
+        if (node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+        auto parent = node->getParentEdgeAt(0)->getParent();
+        if (parent->getType() != Input || parent->isConstant())
+            return false;
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get depthwise node " << node->getName();
+        if (depthwiseNode->getAlgorithm() != depthwise_scale_shift || depthwiseNode->isBroadcast())
+            return false;
+
+        auto* scaleShiftLayer = dynamic_cast<ScaleShiftLayer*>(node->getCnnLayer().get());
+        return scaleShiftLayer != nullptr && scaleShiftLayer->_weights != nullptr &&
+               scaleShiftLayer->_weights->getTensorDesc().getPrecision() == Precision::FP32 &&
+               (scaleShiftLayer->_biases == nullptr ||
+                scaleShiftLayer->_biases->getTensorDesc().getPrecision() == Precision::FP32);
+    };
+
+    auto isSutableConvNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Convolution || node->getCnnLayer()->precision != Precision::FP32)
+            return false;
+        auto* convNode = dynamic_cast<MKLDNNConvolutionNode *>(node.get());
+        if (convNode == nullptr || convNode->getBaseIntputsNumber() != 1 || !convNode->getMergeWith().empty())
+            return false;
+
+        auto* convLayer = dynamic_cast<ConvolutionLayer*>(node->getCnnLayer().get());
+        return convLayer != nullptr && convLayer->_group == 1 && convLayer->_weights != nullptr &&
+               convLayer->_weights->getTensorDesc().getPrecision() == Precision::FP32 &&
+               (convLayer->_biases == nullptr || convLayer->_biases->getTensorDesc().getPrecision() == Precision::FP32);
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto scaleShift = graphNodes[i];
+        if (!isSutableScaleShiftNode(scaleShift)) continue;
+
+        auto conv = scaleShift->getChildEdgeAt(0)->getChild();
+        if (!isSutableConvNode(conv)) continue;
+
+        auto* scaleShiftLayer = dynamic_cast<ScaleShiftLayer*>(scaleShift->getCnnLayer().get());
+        auto* convLayer = dynamic_cast<ConvolutionLayer*>(conv->getCnnLayer().get());
+
+        const size_t IC = scaleShiftLayer->_weights->size();
+        const size_t OC = convLayer->_out_depth;
+        if (OC == 0 || IC == 0 || convLayer->_weights->size() % (OC * IC) != 0) continue;
+        const size_t kernelSize = convLayer->_weights->size() / (OC * IC);
+
+        const float* scales = scaleShiftLayer->_weights->cbuffer().as<const float*>();
+        const float* shifts = scaleShiftLayer->_biases ? scaleShiftLayer->_biases->cbuffer().as<const float*>() : nullptr;
+        if (shifts != nullptr && scaleShiftLayer->_biases->size() != IC) continue;
+
+        bool withShift = false;
+        for (size_t c = 0; shifts != nullptr && c < IC; c++) {
+            withShift |= shifts[c] != 0.0f;
+        }
+
+        // Padded zeros would be shifted before convolution, so shift can be folded into biases only without padding
+        if (withShift) {
+            auto allPads = getPaddings(*convLayer);
+            bool withPadding = false;
+            for (size_t j = 0; j < allPads.begin.size(); j++) {
+                withPadding |= allPads.begin[j] != 0 || allPads.end[j] != 0;
+            }
+            if (withPadding) continue;
+        }
+
+        // New blobs are created since original ones may be shared with other graphs
+        auto weights = make_shared_blob<float>(convLayer->_weights->getTensorDesc());
+        weights->allocate();
+        auto biases = make_shared_blob<float>(TensorDesc(Precision::FP32, {OC}, Layout::C));
+        biases->allocate();
+
+        const float* srcWeights = convLayer->_weights->cbuffer().as<const float*>();
+        const float* srcBiases = convLayer->_biases && convLayer->_biases->size() == OC ?
+                                 convLayer->_biases->cbuffer().as<const float*>() : nullptr;
+        float* dstWeights = weights->data();
+        float* dstBiases = biases->data();
+
+        parallel_for(OC, [&](size_t oc) {
+            float bias = srcBiases ? srcBiases[oc] : 0.0f;
+            for (size_t ic = 0; ic < IC; ic++) {
+                const size_t offset = (oc * IC + ic) * kernelSize;
+                for (size_t k = 0; k < kernelSize; k++) {
+                    dstWeights[offset + k] = srcWeights[offset + k] * scales[ic];
+                    if (shifts)
+                        bias += srcWeights[offset + k] * shifts[ic];
+                }
+            }
+            dstBiases[oc] = bias;
+        });
+
+        convLayer->_weights = weights;
+        convLayer->_biases = biases;
+        convLayer->blobs["weights"] = weights;
+        convLayer->blobs["biases"] = biases;
+
+        graph.DropNode(scaleShift);
+    }
+}
 #endif
 
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
@@ -29,6 +29,7 @@ private:
 #endif
 #if defined (COMPILED_CPU_MKLDNN_DEPTHWISE_NODE)
     void FuseConvolutionAndDepthwise(MKLDNNGraph &graph);
+    void FuseInputScaleShiftAndConvolution(MKLDNNGraph &graph);
 #endif
     void FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
@@ -77,96 +77,94 @@ void copyToFloat(float* dst, const InferenceEngine::Blob* src) {
 
 }  // namespace
 
-void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
+bool MKLDNNPlugin::MKLDNNInferRequest::IsPreprocessingRequired() const {
+    if (!_preProcData.empty())
+        return true;
+    for (auto&& input : _inputs) {
+        if (input.second->getTensorDesc().getPrecision() == InferenceEngine::Precision::U16)
+            return true;
+    }
+    return false;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PreprocessInputs(bool serial) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "PreprocessInputs");
+
+    execDataPreprocessing(_inputs, serial);
+
+    // need to retain converted blobs until infer finish
+    preparedInputs.clear();
+    for (auto input : _inputs) {
+        if (!_networkInputs[input.first]) {
+            THROW_IE_EXCEPTION <<
+                                "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
+                                << input.first;
+        }
+
+        if (input.second->getTensorDesc().getPrecision() != InferenceEngine::Precision::U16) {
+            // mean and scale are applied by the graph, so other precisions are sent directly
+            preparedInputs[input.first] = input.second;
+            continue;
+        }
+
+        InferenceEngine::Blob::Ptr iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                                                     input.second->getTensorDesc().getDims(),
+                                                                                     input.second->getTensorDesc().getLayout()});
+        iconv->allocate();
+        InferenceEngine::TBlob<float> *in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
+        if (in_f == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get TBlob";
+        // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
+        copyToFloat<uint16_t>(in_f->data(), input.second.get());
+        preparedInputs[input.first] = iconv;
+    }
+    inputsPrepared = true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferGraph() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
 
     graph = execNetwork->_graphs.local().get();
-    {
-        execDataPreprocessing(_inputs);
-
-        changeDefaultPtr();
-
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
-        for (auto input : _inputs) {
-            if (!_networkInputs[input.first]) {
-                THROW_IE_EXCEPTION <<
-                                    "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
-                                    << input.first;
-            }
+    if (!inputsPrepared)
+        PreprocessInputs();
+    inputsPrepared = false;
 
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
-            switch (input.second->getTensorDesc().getPrecision()) {
-                case InferenceEngine::Precision::FP32:
-                    pushInput<float>(input.first, input.second);
-                    break;
-                case InferenceEngine::Precision::I32:
-                    pushInput<int32_t>(input.first, input.second);
-                    break;
-                case InferenceEngine::Precision::I8:
-                    pushInput<int8_t>(input.first, input.second);
-                    break;
-                case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                        input.second->getTensorDesc().getDims(),
-                                                                        input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
-                    break;
-                case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                            input.second->getTensorDesc().getDims(),
-                                                                            input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
-                    }
-                    break;
-                case InferenceEngine::Precision::U8:
-                case InferenceEngine::Precision::BOOL:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                            input.second->getTensorDesc().getDims(),
-                                                                            input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
-                    break;
-                default:
-                    THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
-            }
+    changeDefaultPtr();
+
+    for (auto input : preparedInputs) {
+        switch (input.second->getTensorDesc().getPrecision()) {
+            case InferenceEngine::Precision::FP32:
+                pushInput<float>(input.first, input.second);
+                break;
+            case InferenceEngine::Precision::I32:
+                pushInput<int32_t>(input.first, input.second);
+                break;
+            case InferenceEngine::Precision::I8:
+                pushInput<int8_t>(input.first, input.second);
+                break;
+            case InferenceEngine::Precision::I16:
+                pushInput<int16_t>(input.first, input.second);
+                break;
+            case InferenceEngine::Precision::U8:
+            case InferenceEngine::Precision::BOOL:
+                pushInput<uint8_t>(input.first, input.second);
+                break;
+            default:
+                THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
         }
     }
 
     graph->Infer(m_curBatch);
 
     graph->PullOutputData(_outputs);
+
+    preparedInputs.clear();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
+    PreprocessInputs();
+    InferGraph();
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
@@ -211,8 +209,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        if (desc.getPrecision() == originPrecision && !graph->getProperty().batchLimit) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
@@ -230,8 +227,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (!graph->getProperty().batchLimit && graph->IsOutputBindable(name, _outputs[name]->getTensorDesc())) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -260,12 +256,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
     InferenceEngine::DataPtr foundOutput;
     size_t dataSize = data->size();
     if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
-        if (foundInput->getPrecision() != data->getTensorDesc().getPrecision()) {
+        const bool preProcRequired = preProcessingRequired(foundInput, data);
+        // U8 image is converted into floating point network input by pre-processing
+        if (foundInput->getPrecision() != data->getTensorDesc().getPrecision() &&
+            !(preProcRequired && preProcessingConvertsPrecision(foundInput, data))) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set Blob with precision "
                                << data->getTensorDesc().getPrecision();
         }
 
-        const bool preProcRequired = preProcessingRequired(foundInput, data);
         if (compoundBlobPassed && !preProcRequired) {
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                << "cannot set compound blob: supported only for input pre-processing";
@@ -273,7 +271,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
 
         if (preProcRequired) {
             if (_preProcData.find(name) == _preProcData.end()) {
-                _preProcData.emplace(name, InferenceEngine::CreatePreprocDataHelper());
+                auto preProcData = InferenceEngine::CreatePreprocDataHelper();
+                preProcData->setCacheOwner(_exeNetwork.get());
+                _preProcData.emplace(name, preProcData);
             }
             _preProcData[name]->isApplicable(data, _inputs[name]);
             // Stores the given blob as ROI blob. It will be used to fill in network input during
@@ -293,7 +293,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             }
 
             if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+                !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -319,8 +319,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        // Output is written directly to the user blob if its memory layout matches the one of the graph
+        if (!graph->getProperty().batchLimit && graph->IsOutputBindable(name, data->getTensorDesc())) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -371,40 +371,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             continue;
         }
 
-        MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
-                output = out;
-                break;
-            }
-        }
-        if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
+        if (_networkOutputs.find(it.first) == _networkOutputs.end())
+            THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
+    }
 
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
-            continue;
-        }
-        THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
+    // Requests share the graph, so outputs without external pointer get the graph memory back
+    for (auto& output : _networkOutputs) {
+        auto it = externalPtr.find(output.first);
+        graph->BindOutputMemory(output.first, it != externalPtr.end() ? it->second : nullptr);
     }
 }
 
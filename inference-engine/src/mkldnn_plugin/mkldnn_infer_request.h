@@ -25,6 +25,23 @@ public:
 
     void InferImpl() override;
 
+    /**
+     * @brief Checks whether inputs need data pre-processing or precision conversion
+     */
+    bool IsPreprocessingRequired() const;
+
+    /**
+     * @brief Runs input pre-processing and precision conversion into request owned blobs.
+     *        Does not use the graph memory, so may be executed out of stream threads
+     * @param serial Whether to use single thread
+     */
+    void PreprocessInputs(bool serial = false);
+
+    /**
+     * @brief Pushes prepared inputs to the graph of the current stream, infers and pulls outputs
+     */
+    void InferGraph();
+
     void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
     /**
@@ -50,6 +67,8 @@ private:
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    InferenceEngine::BlobMap            preparedInputs;
+    bool                                inputsPrepared = false;
     openvino::itt::handle_t             profilingTask;
 };
 }  // namespace MKLDNNPlugin
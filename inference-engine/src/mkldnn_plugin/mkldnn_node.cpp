@@ -729,6 +729,38 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
     return internalBlob;
 }
 
+static std::string getDescKey(const InferenceEngine::TensorDesc& desc) {
+    std::string key = desc.getPrecision().name();
+    const auto& blockingDesc = desc.getBlockingDesc();
+    for (auto dim : blockingDesc.getBlockDims()) key += "_" + std::to_string(dim);
+    key += "|";
+    for (auto order : blockingDesc.getOrder()) key += "_" + std::to_string(order);
+    key += "|" + std::to_string(blockingDesc.getOffsetPadding());
+    return key;
+}
+
+// Internal weight layouts (blocked, wino) can not be expressed as TensorDesc,
+// so the key is built from the raw mkldnn descriptor. Int8 compensation is a part of the format.
+static std::string getDescKey(const MKLDNNMemoryDesc& desc) {
+    const mkldnn_memory_desc_t& data = static_cast<mkldnn::memory::desc>(desc).data;
+    std::string key = std::to_string(data.format) + "_" + std::to_string(data.data_type);
+    for (int i = 0; i < data.ndims; i++) key += "_" + std::to_string(data.dims[i]);
+    key += "|";
+    if (data.format == mkldnn_wino_fmt) {
+        auto bytes = reinterpret_cast<const unsigned char*>(&data.layout_desc);
+        for (size_t i = 0; i < sizeof(data.layout_desc); i++) key += "_" + std::to_string(bytes[i]);
+    } else {
+        const auto& blocking = data.layout_desc.blocking;
+        for (int i = 0; i < data.ndims; i++) {
+            key += "_" + std::to_string(blocking.block_dims[i]) + "." + std::to_string(blocking.strides[0][i])
+                   + "." + std::to_string(blocking.strides[1][i]) + "." + std::to_string(blocking.padding_dims[i])
+                   + "." + std::to_string(blocking.offset_padding_to_data[i]);
+        }
+        key += "|" + std::to_string(blocking.offset_padding);
+    }
+    return key;
+}
+
 void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::primitive_desc_iterator& itpd) {
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         auto &dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
@@ -775,11 +807,14 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             const uint64_t data_hash = weightCache->GetHashFunc().hash(
                     internalBlob->buffer(), internalBlob->byteSize());
 
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+            // The key is built from content and layouts only, so equal weights of different layers
+            // and networks are stored once; the cache compares the source bytes before reusing an entry
+            const std::string string_hash = std::to_string(internalBlob->byteSize())
+                                            + "_" + std::to_string(data_hash)
+                                            + "_" + getDescKey(internalBlob->getTensorDesc())
+                                            + "_" + getDescKey(intDescs[i]);
 
-            ptr = weightCache->findOrCreate(string_hash, create);
+            ptr = weightCache->findOrCreate(string_hash, internalBlob, create);
         } else {
             ptr = create();
         }
@@ -7,9 +7,11 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 
 #include <net_pass.h>
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
@@ -21,6 +23,7 @@
 #include <ie_util_internal.hpp>
 #include <graph_transformer.h>
 #include <ie_ngraph_utils.hpp>
+#include <xml_parse_utils.h>
 
 #include "convert_function_to_cnn_network.hpp"
 #include <transformations/apply_transformations_to_ti_body.hpp>
@@ -183,6 +186,104 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
     return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
+ExecutableNetwork Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    std::string cpuXmlStr;
+    std::getline(networkModel, cpuXmlStr);
+
+    pugi::xml_document cpuXmlDoc;
+    pugi::xml_parse_result res = cpuXmlDoc.load(cpuXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+    pugi::xml_node cpuNode = cpuXmlDoc.document_element();
+
+    std::map<std::string, std::string> importedConfig;
+    auto configsNode = cpuNode.child("configs");
+    FOREACH_CHILD(configNode, configsNode, "config") {
+        importedConfig.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    for (auto&& option : config) {
+        importedConfig[option.first] = option.second;
+    }
+    Config conf = engConfig;
+    conf.readProperties(importedConfig);
+
+    auto network = DeserializeNetwork(networkModel, *GetCore());
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(
+        static_cast<ICNNNetwork::Ptr>(network));
+    IE_ASSERT(nullptr != implNetwork);
+    implNetwork->setName(GetStrAttr(cpuNode, "name"));
+
+    auto inputsInfo = network.getInputsInfo();
+    auto inputsNode = cpuNode.child("inputs");
+    FOREACH_CHILD(inputNode, inputsNode, "input") {
+        auto itInput = inputsInfo.find(GetStrAttr(inputNode, "name"));
+        if (inputsInfo.end() == itInput) {
+            THROW_IE_EXCEPTION << "Exported network does not contain input " << GetStrAttr(inputNode, "name");
+        }
+        auto& input = itInput->second;
+        input->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+
+        auto& preProcess = input->getPreProcess();
+        preProcess.setResizeAlgorithm(static_cast<ResizeAlgorithm>(GetIntAttr(inputNode, "resize")));
+        preProcess.setColorFormat(static_cast<ColorFormat>(GetIntAttr(inputNode, "color")));
+        preProcess.setLetterbox(GetBoolAttr(inputNode, "letterbox", false), GetFloatAttr(inputNode, "pad_value", 0.f));
+        std::vector<pugi::xml_node> channels;
+        FOREACH_CHILD(channelNode, inputNode, "channel") {
+            channels.push_back(channelNode);
+        }
+        if (!channels.empty()) {
+            preProcess.init(channels.size());
+            for (size_t c = 0; c < channels.size(); c++) {
+                preProcess[c]->meanValue = GetFloatAttr(channels[c], "mean");
+                preProcess[c]->stdScale = GetFloatAttr(channels[c], "scale");
+            }
+            preProcess.setVariant(MEAN_VALUE);
+        }
+    }
+
+    auto outputsNode = cpuNode.child("outputs");
+    FOREACH_CHILD(outputNode, outputsNode, "output") {
+        auto outputName = GetStrAttr(outputNode, "name");
+        CNNLayerPtr creator;
+        if (OK != implNetwork->getLayerByName(GetStrAttr(outputNode, "creatorName").c_str(), creator, nullptr)) {
+            THROW_IE_EXCEPTION << "Exported network does not contain layer " << GetStrAttr(outputNode, "creatorName");
+        }
+        auto data = creator->outData.at(GetUInt64Attr(outputNode, "index"));
+        if (data->getName() != outputName) {
+            implNetwork->removeOutput(data->getName());
+            data->setName(outputName);
+            implNetwork->addData(outputName.c_str(), data);
+        }
+        implNetwork->addOutput(outputName);
+        data->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        data->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(network.getInputsInfo(), network.getOutputsInfo(), networkInputs, networkOutputs);
+
+    auto impl = std::make_shared<MKLDNNExecNetwork>(*implNetwork, conf, extensionManager, weightsSharing, true);
+    impl->setNetworkInputs(networkInputs);
+    impl->setNetworkOutputs(networkOutputs);
+    impl->SetPointerToPluginInternal(shared_from_this());
+
+    IExecutableNetwork::Ptr executableNetwork;
+    executableNetwork.reset(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl),
+                            [](details::IRelease *p) {p->Release();});
+    return ExecutableNetwork{executableNetwork};
+}
+
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
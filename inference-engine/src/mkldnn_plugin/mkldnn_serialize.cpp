@@ -0,0 +1,174 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialize.h"
+
+#include <ie_layers.h>
+#include <caseless.hpp>
+#include <cpp_interfaces/exception2status.hpp>
+#include <details/ie_cnn_network_tools.h>
+#include <file_utils.h>
+#include <pugixml.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// The lowest IR version which describes output port precisions
+constexpr unsigned int serializedIRVersion = 7;
+
+std::uint64_t FillXmlDoc(const std::vector<CNNLayerPtr>& ordered, const std::string& name, pugi::xml_document& doc) {
+    pugi::xml_node netXml = doc.append_child("net");
+    netXml.append_attribute("name").set_value(name.c_str());
+    netXml.append_attribute("version").set_value(serializedIRVersion);
+
+    std::map<CNNLayer*, std::size_t> matching;
+    for (std::size_t i = 0; i < ordered.size(); i++) {
+        matching[ordered[i].get()] = i;
+    }
+
+    std::uint64_t dataOffset = 0;
+    pugi::xml_node layers = netXml.append_child("layers");
+    for (std::size_t i = 0; i < ordered.size(); ++i) {
+        const auto& node = ordered[i];
+        if (CaselessEq<std::string>()(node->type, "TensorIterator")) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of TensorIterator layer " << node->name << " is not supported";
+        }
+
+        pugi::xml_node layer = layers.append_child("layer");
+        layer.append_attribute("name").set_value(node->name.c_str());
+        layer.append_attribute("type").set_value(node->type.c_str());
+        layer.append_attribute("precision").set_value(node->precision.name());
+        layer.append_attribute("id").set_value(i);
+
+        if (!node->params.empty()) {
+            pugi::xml_node data = layer.append_child("data");
+            for (const auto& param : node->params) {
+                data.append_attribute(param.first.c_str()).set_value(param.second.c_str());
+            }
+        }
+
+        if (!node->insData.empty()) {
+            pugi::xml_node input = layer.append_child("input");
+            for (std::size_t iport = 0; iport < node->insData.size(); iport++) {
+                pugi::xml_node port = input.append_child("port");
+                port.append_attribute("id").set_value(iport);
+                for (auto dim : node->insData[iport].lock()->getDims()) {
+                    port.append_child("dim").text().set(dim);
+                }
+            }
+        }
+
+        if (!node->outData.empty()) {
+            pugi::xml_node output = layer.append_child("output");
+            for (std::size_t oport = 0; oport < node->outData.size(); oport++) {
+                pugi::xml_node port = output.append_child("port");
+                port.append_attribute("id").set_value(node->insData.size() + oport);
+                port.append_attribute("precision").set_value(node->outData[oport]->getPrecision().name());
+                for (auto dim : node->outData[oport]->getDims()) {
+                    port.append_child("dim").text().set(dim);
+                }
+            }
+        }
+
+        if (!node->blobs.empty()) {
+            pugi::xml_node blobs = layer.append_child("blobs");
+            for (const auto& blob : node->blobs) {
+                if (!blob.second) continue;
+                const std::uint64_t dataSize = blob.second->byteSize();
+                pugi::xml_node data = blobs.append_child(blob.first.c_str());
+                data.append_attribute("offset").set_value(dataOffset);
+                data.append_attribute("size").set_value(dataSize);
+                data.append_attribute("precision").set_value(blob.second->getTensorDesc().getPrecision().name());
+                dataOffset += dataSize;
+            }
+        }
+    }
+
+    pugi::xml_node edges = netXml.append_child("edges");
+    for (const auto& node : ordered) {
+        for (std::size_t oport = 0; oport < node->outData.size(); oport++) {
+            const DataPtr& outData = node->outData[oport];
+            for (const auto& inputTo : getInputTo(outData)) {
+                auto itTo = matching.find(inputTo.second.get());
+                if (itTo == matching.end()) {
+                    THROW_IE_EXCEPTION << "Broken edge from layer " << node->name << " to layer " << inputTo.first
+                                       << " during export of network";
+                }
+                for (std::size_t iport = 0; iport < inputTo.second->insData.size(); iport++) {
+                    if (inputTo.second->insData[iport].lock() != outData) continue;
+                    pugi::xml_node edge = edges.append_child("edge");
+                    edge.append_attribute("from-layer").set_value(matching[node.get()]);
+                    edge.append_attribute("from-port").set_value(node->insData.size() + oport);
+                    edge.append_attribute("to-layer").set_value(itTo->second);
+                    edge.append_attribute("to-port").set_value(iport);
+                }
+            }
+        }
+    }
+
+    return dataOffset;
+}
+
+}  // namespace
+
+void AssertIRv7ReaderExists() {
+    auto readerLibrary = FileUtils::makeSharedLibraryName(getInferenceEngineLibraryPath(),
+        FileUtils::toFilePath(std::string("inference_engine_ir_v7_reader") + std::string(IE_BUILD_POSTFIX)));
+    if (!FileUtils::fileExist(readerLibrary)) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export and import of CPU networks require IR v7 reader library "
+                           << FileUtils::fromFilePath(readerLibrary) << " which is not found";
+    }
+}
+
+void SerializeNetwork(std::ostream& stream, const ICNNNetwork& network) {
+    const auto ordered = CNNNetSortTopologically(network);
+
+    pugi::xml_document doc;
+    std::uint64_t dataSize = FillXmlDoc(ordered, network.getName(), doc);
+    doc.save(stream, nullptr, pugi::format_raw);
+    stream << std::endl;
+
+    stream.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    for (const auto& node : ordered) {
+        for (const auto& blob : node->blobs) {
+            if (!blob.second) continue;
+            stream.write(blob.second->cbuffer().as<const char*>(), blob.second->byteSize());
+        }
+    }
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Error during writing weights of network " << network.getName();
+    }
+}
+
+CNNNetwork DeserializeNetwork(std::istream& stream, const ICore& core) {
+    AssertIRv7ReaderExists();
+    std::string xmlString;
+    std::getline(stream, xmlString);
+
+    std::uint64_t dataSize = 0;
+    stream.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+
+    Blob::Ptr dataBlob;
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        stream.read(dataBlob->buffer(), dataSize);
+    }
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Error during reading of exported network";
+    }
+
+    return core.ReadNetwork(xmlString, std::move(dataBlob));
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,41 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_icnn_network.hpp>
+#include <ie_icore.hpp>
+#include <cpp/ie_cnn_network.h>
+
+#include <istream>
+#include <ostream>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Checks that IR v7 reader library, which is optional and loaded by Core at runtime, is available.
+ *        Exported networks are read back by this reader, so export and import are not possible without it.
+ * @throws NOT_IMPLEMENTED status exception if the reader library is not found
+ */
+void AssertIRv7ReaderExists();
+
+/**
+ * @brief Writes network in the IR v7 compatible form: a single line XML document followed by
+ *        the size of weights section and weights data.
+ * @note Used to export networks which were already processed by CPU plugin transformations, so
+ *       only layers representable by legacy IR are supported.
+ * @param stream    Output stream
+ * @param network   Network to be serialized
+ */
+void SerializeNetwork(std::ostream& stream, const InferenceEngine::ICNNNetwork& network);
+
+/**
+ * @brief Reads network written by SerializeNetwork, requires IR v7 reader library
+ * @param stream    Input stream
+ * @param core      Core used to parse IR v7 representation
+ * @return Restored network
+ */
+InferenceEngine::CNNNetwork DeserializeNetwork(std::istream& stream, const InferenceEngine::ICore& core);
+
+}  // namespace MKLDNNPlugin
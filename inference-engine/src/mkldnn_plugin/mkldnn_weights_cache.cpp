@@ -5,11 +5,123 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
+namespace {
+
+constexpr uint64_t prime1 = 11400714785074694791ULL;
+constexpr uint64_t prime2 = 14029467366897019727ULL;
+constexpr uint64_t prime3 = 1609587929392839161ULL;
+constexpr uint64_t prime4 = 9650029242287828579ULL;
+constexpr uint64_t prime5 = 2870177450012600261ULL;
+
+// Chunk size for parallel hashing. Must not change, otherwise hash values change
+constexpr size_t hashChunkSize = 1 << 20;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t hashRound(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+    acc ^= hashRound(0, val);
+    return acc * prime1 + prime4;
+}
+
+uint64_t xxhash64(const unsigned char* data, size_t size, uint64_t seed) {
+    const unsigned char* p = data;
+    const unsigned char* const end = data + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        // four independent lanes keep several multipliers busy at once
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+        const unsigned char* const limit = end - 32;
+        do {
+            v1 = hashRound(v1, read64(p));
+            v2 = hashRound(v2, read64(p + 8));
+            v3 = hashRound(v3, read64(p + 16));
+            v4 = hashRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= hashRound(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= (*p) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+}  // namespace
+
+uint64_t DataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= hashChunkSize)
+        return xxhash64(data, size, 0);
+
+    const size_t chunks = (size + hashChunkSize - 1) / hashChunkSize;
+    std::vector<uint64_t> chunkHashes(chunks);
+    InferenceEngine::parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * hashChunkSize;
+        chunkHashes[i] = xxhash64(data + offset, std::min(hashChunkSize, size - offset), i);
+    });
+    return xxhash64(reinterpret_cast<const unsigned char*>(chunkHashes.data()),
+                    chunkHashes.size() * sizeof(uint64_t), size);
+}
+
+const DataHash MKLDNNWeightsSharing::dataHash;
+constexpr size_t MKLDNNWeightsSharing::minPruneSize;
 
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
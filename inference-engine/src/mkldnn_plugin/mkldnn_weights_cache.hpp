@@ -5,73 +5,100 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include <ie_blob.h>
 
 #include <unordered_map>
+#include <cstring>
 #include <functional>
 #include <string>
 #include <memory>
 #include <mutex>
 #include <map>
+#include <algorithm>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
-//       For same cases it may be switched of (like for single stream execution)
+//       The cache also deduplicates identical weights of different networks.
 //       When MKLDNNGraph clone function will be ready you may removed this
 //       classes at all.
 
 namespace MKLDNNPlugin {
 
-class SimpleDataHash {
+/**
+ * Fast non-cryptographic 64-bit hash of raw data (XXH64 algorithm).
+ * Large buffers are split into chunks of fixed size which are hashed in parallel,
+ * so the result does not depend on the number of threads.
+ */
+class DataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    uint64_t hash(const unsigned char* data, size_t size) const;
 };
 
 /**
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
  *
+ * Objects are addressed by content, so identical weights of different
+ * networks loaded to the same plugin share one memory object. Every entry
+ * keeps its source blob, and a hit is reused only if the source bytes are
+ * equal, so a hash collision never hands out foreign weights.
+ *
  * Is a thread safe
  */
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
+                             const InferenceEngine::Blob::CPtr& source,
                              std::function<MKLDNNMemoryPtr(void)> create) {
         std::unique_lock<std::mutex> lock(guard);
         auto found = sharedWeights.find(name_hash);
 
         MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
+        if (found == sharedWeights.end() || !(ptr = found->second.memory.lock())) {
+            ptr = create();
+            sharedWeights[name_hash] = {ptr, source};
+            removeExpired();
+        } else if (!sameData(found->second.source, source)) {
+            // Hash collision: keep the cached entry and give this blob a private copy
             ptr = create();
-            sharedWeights[name_hash] = ptr;
         }
         return ptr;
     }
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+    static const DataHash& GetHashFunc () { return dataHash; }
 
 protected:
-    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+    struct Entry {
+        std::weak_ptr<MKLDNNMemory> memory;
+        InferenceEngine::Blob::CPtr source;
+    };
+
+    static bool sameData(const InferenceEngine::Blob::CPtr& lhs, const InferenceEngine::Blob::CPtr& rhs) {
+        if (lhs == rhs)
+            return true;
+        if (!lhs || !rhs || lhs->byteSize() != rhs->byteSize())
+            return false;
+        return std::memcmp(lhs->cbuffer().as<const void*>(), rhs->cbuffer().as<const void*>(), lhs->byteSize()) == 0;
+    }
+
+    // Entries of released networks are dropped once the map doubles in size
+    void removeExpired() {
+        if (sharedWeights.size() < 2 * aliveWeights)
+            return;
+        for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+            if (it->second.memory.expired())
+                it = sharedWeights.erase(it);
+            else
+                ++it;
+        }
+        aliveWeights = std::max(sharedWeights.size(), minPruneSize);
+    }
+
+    static constexpr size_t minPruneSize = 64;
+    std::unordered_map<std::string, Entry> sharedWeights;
+    size_t aliveWeights = minPruneSize;
     std::mutex guard;
-    static const SimpleDataHash simpleCRC;
+    static const DataHash dataHash;
 };
 
 /**
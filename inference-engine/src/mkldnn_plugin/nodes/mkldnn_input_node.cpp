@@ -48,7 +48,7 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
     memory::format outFormat = mkldnn::memory::format_undef;
     if (getType() == Input || getType() == MemoryInput) {
         precision = getCnnLayer()->outData[0]->getPrecision();
-        if (precision == InferenceEngine::Precision::U16 || isMeanImage) {
+        if (precision == InferenceEngine::Precision::U16) {
             precision = InferenceEngine::Precision::FP32;
         }
         auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
@@ -21,15 +21,11 @@ public:
     bool created() const override;
 
     void execute(mkldnn::stream strm) override;
-    void withMeanImage() {
-        isMeanImage = true;
-    }
 
 private:
     InferenceEngine::Precision precision;
 
     InferenceEngine::Blob::Ptr constBlob;
-    bool isMeanImage = false;
 };
 
 }  // namespace MKLDNNPlugin
@@ -16,11 +16,13 @@
 #include <ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include <algorithm>
+#include <sstream>
 
 #include "jit_generator.hpp"
 #include "jit_uni_eltwise.hpp"
 #include "jit_uni_depthwise.hpp"
 #include "jit_uni_quantization.hpp"
+#include "utils/jit_kernel_cache.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -433,6 +435,33 @@ private:
 };
 //////////////////////////////////////////////////////////////////////////////////
 
+template <cpu_isa_t isa>
+static std::string getMVNKernelKey(const jit_mvn_config_params& jcp) {
+    std::ostringstream key;
+    key << isa << "_" << jcp.planar_layout << jcp.across_channels << jcp.normalize_variance << "_" << jcp.src_dt << "_" << jcp.dst_dt;
+    return key.str();
+}
+
+// Kernels without post ops depend only on config params, so they are shared through the JIT kernel cache
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_mvn_mean_variance_kernel> getMVNMeanVarianceKernel(const jit_mvn_config_params& jcp) {
+    return JitKernelCache::getInstance().getOrCreate<jit_uni_mvn_mean_variance_kernel>(getMVNKernelKey<isa>(jcp),
+        [&jcp]() -> std::shared_ptr<jit_uni_mvn_mean_variance_kernel> {
+            return std::make_shared<jit_uni_mvn_mean_variance_kernel_f32<isa>>(jcp);
+        });
+}
+
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_mvn_kernel> getMVNKernel(const jit_mvn_config_params& jcp, const mkldnn_primitive_attr& attr,
+                                                        bool withPostOps) {
+    if (withPostOps)
+        return std::make_shared<jit_uni_mvn_kernel_f32<isa>>(jcp, attr);
+    return JitKernelCache::getInstance().getOrCreate<jit_uni_mvn_kernel>(getMVNKernelKey<isa>(jcp),
+        [&jcp, &attr]() -> std::shared_ptr<jit_uni_mvn_kernel> {
+            return std::make_shared<jit_uni_mvn_kernel_f32<isa>>(jcp, attr);
+        });
+}
+
 MKLDNNMVNNode::MKLDNNMVNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(layer, eng, cache) {}
 
@@ -557,31 +586,31 @@ void MKLDNNMVNNode::createPrimitive() {
     jcp.across_channels = across_channels;
 
     if (mayiuse(cpu::avx512_common)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
+        mvn_kernel = getMVNKernel<cpu::avx512_common>(jcp, *attr.get(), !fusedWith.empty());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
+        mvn_mean_kernel = getMVNMeanVarianceKernel<cpu::avx512_common>(jcp);
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
+            mvn_variance_kernel = getMVNMeanVarianceKernel<cpu::avx512_common>(jcp);
         }
     } else if (mayiuse(cpu::avx2)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx2>(jcp, *attr.get()));
+        mvn_kernel = getMVNKernel<cpu::avx2>(jcp, *attr.get(), !fusedWith.empty());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
+        mvn_mean_kernel = getMVNMeanVarianceKernel<cpu::avx2>(jcp);
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
+            mvn_variance_kernel = getMVNMeanVarianceKernel<cpu::avx2>(jcp);
         }
     } else if (mayiuse(cpu::sse42)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::sse42>(jcp, *attr.get()));
+        mvn_kernel = getMVNKernel<cpu::sse42>(jcp, *attr.get(), !fusedWith.empty());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp));
+        mvn_mean_kernel = getMVNMeanVarianceKernel<cpu::sse42>(jcp);
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp));
+            mvn_variance_kernel = getMVNMeanVarianceKernel<cpu::sse42>(jcp);
         }
     }
 }
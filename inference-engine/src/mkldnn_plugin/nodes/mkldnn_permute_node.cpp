@@ -9,7 +9,9 @@
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
+#include "utils/jit_kernel_cache.h"
 #include <algorithm>
+#include <sstream>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -130,6 +132,23 @@ private:
     Xbyak::Xmm xmm = Xbyak::Xmm(0);
 };
 
+template <cpu::cpu_isa_t isa>
+static std::shared_ptr<jit_uni_permute_kernel> getPermuteKernel(const jit_permute_conf_t& jpp) {
+    // Generated code depends only on ISA and the fields of permute configuration listed in the key, so it is shared
+    // between nodes. Nodes keep own configuration for execution, since other fields (e.g. dynamic batch) may differ.
+    std::ostringstream key;
+    key << isa << "_" << jpp.ndims << "_" << jpp.n << "_" << jpp.data_size;
+    for (const auto& dims : {jpp.dst_block_dims, jpp.src_strides, jpp.dst_strides}) {
+        key << "_";
+        for (auto dim : dims)
+            key << dim << ",";
+    }
+    return JitKernelCache::getInstance().getOrCreate<jit_uni_permute_kernel>(key.str(),
+        [&jpp]() -> std::shared_ptr<jit_uni_permute_kernel> {
+            return std::make_shared<jit_uni_permute_kernel_f32<isa>>(jpp);
+        });
+}
+
 MKLDNNPermuteNode::MKLDNNPermuteNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(layer, eng, cache) {}
 
@@ -229,7 +248,7 @@ void MKLDNNPermuteNode::createPrimitive() {
     Precision precision = getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getPrecision();
     auto data_type = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
 
-    jit_permute_conf_t jpp;
+    jpp = jit_permute_conf_t();
 
     auto srcDesc = getParentEdgeAt(0)->getBlob()->getTensorDesc();
     auto src_dims = srcDesc.getDims();
@@ -345,11 +364,11 @@ void MKLDNNPermuteNode::createPrimitive() {
     jpp.data_size = MKLDNNExtensionUtils::sizeOfDataType(data_type);
 
     if (mayiuse(cpu::avx512_common)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx512_common>(jpp));
+        permute_kernel = getPermuteKernel<cpu::avx512_common>(jpp);
     } else if (mayiuse(cpu::avx2)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx2>(jpp));
+        permute_kernel = getPermuteKernel<cpu::avx2>(jpp);
     } else if (mayiuse(cpu::sse42)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::sse42>(jpp));
+        permute_kernel = getPermuteKernel<cpu::sse42>(jpp);
     }
 }
 
@@ -883,8 +902,6 @@ void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
         auto src_data = reinterpret_cast<const char *>(srcMemPtr->GetData());
         auto dst_data = reinterpret_cast<char *>(dstMemPtr->GetData());
 
-        const auto &jpp = (*permute_kernel).jpp;
-
         src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding * jpp.data_size;
         dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding * jpp.data_size;
 
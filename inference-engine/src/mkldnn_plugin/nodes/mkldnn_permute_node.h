@@ -69,6 +69,7 @@ private:
     };
 
     static const std::multimap<InferenceEngine::SizeVector, PermuteImpl> OptimizedCases;
+    jit_permute_conf_t jpp;
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
 };
 
@@ -0,0 +1,48 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_kernel_cache.h"
+
+#include <algorithm>
+
+namespace MKLDNNPlugin {
+
+constexpr size_t JitKernelCache::minPruneSize;
+
+JitKernelCache& JitKernelCache::getInstance() {
+    static JitKernelCache cache;
+    return cache;
+}
+
+void JitKernelCache::removeExpired() {
+    if (kernels.size() < pruneSize)
+        return;
+    for (auto it = kernels.begin(); it != kernels.end();) {
+        if (it->second.expired()) {
+            it = kernels.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    pruneSize = std::max(minPruneSize, 2 * kernels.size());
+}
+
+size_t JitKernelCache::getHits() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return hits;
+}
+
+size_t JitKernelCache::getMisses() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return misses;
+}
+
+size_t JitKernelCache::size() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return std::count_if(kernels.begin(), kernels.end(), [](const std::pair<const std::string, std::weak_ptr<void>>& kernel) {
+        return !kernel.second.expired();
+    });
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,78 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process wide cache of generated JIT kernels. Kernels are shared between nodes with equal parameters,
+ * so identical layers of different streams and networks do not generate the same code again.
+ * Only weak references are stored, so a kernel is released together with the last node which uses it.
+ * Kernel must not keep any node specific state, except parameters which are encoded into the key.
+ */
+class JitKernelCache {
+public:
+    static JitKernelCache& getInstance();
+
+    /**
+     * Returns kernel cached for the key or creates a new one. Code generation is done outside of the lock,
+     * so concurrent requests for the same key may generate kernel twice, but the first one is shared.
+     *
+     * @param key string which uniquely describes generated code, including ISA
+     * @param create kernel factory
+     * @return shared kernel
+     */
+    template <typename Kernel>
+    std::shared_ptr<Kernel> getOrCreate(const std::string& key, const std::function<std::shared_ptr<Kernel>()>& create) {
+        const std::string fullKey = std::string(typeid(Kernel).name()) + "_" + key;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            auto cached = std::static_pointer_cast<Kernel>(kernels[fullKey].lock());
+            if (cached) {
+                hits++;
+                return cached;
+            }
+        }
+
+        std::shared_ptr<Kernel> kernel = create();
+
+        std::lock_guard<std::mutex> lock{mutex};
+        misses++;
+        removeExpired();
+        auto& entry = kernels[fullKey];
+        auto cached = std::static_pointer_cast<Kernel>(entry.lock());
+        if (cached)
+            return cached;
+        entry = kernel;
+        return kernel;
+    }
+
+    size_t getHits() const;
+    size_t getMisses() const;
+    size_t size() const;
+
+private:
+    JitKernelCache() = default;
+
+    // Drops entries of released kernels once the map has grown twice since the previous cleanup
+    void removeExpired();
+
+    static constexpr size_t minPruneSize = 64;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, std::weak_ptr<void>> kernels;
+    size_t pruneSize = minPruneSize;
+    size_t hits = 0;
+    size_t misses = 0;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,123 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.h"
+
+#include <ie_system_conf.h>
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+
+namespace {
+
+// Constants from <numaif.h>, libnuma is not a dependency of the plugin
+constexpr int mpolPreferred = 1;
+constexpr unsigned mpolMfMove = 1u << 1;
+
+bool isMultiNuma() {
+    static const bool multiNuma = InferenceEngine::getAvailableNUMANodes().size() > 1;
+    return multiNuma;
+}
+
+size_t pageSize() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+}  // namespace
+
+bool BindToNumaNode(const void* ptr, size_t size, int numaNodeId) {
+    if (ptr == nullptr || numaNodeId < 0 || !isMultiNuma())
+        return false;
+
+    // mbind requires page aligned address, so neighbour allocations are never touched
+    const auto page = pageSize();
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + page - 1) / page * page;
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / page * page;
+    if (end <= begin)
+        return false;
+
+    constexpr size_t bitsPerMask = sizeof(unsigned long) * CHAR_BIT;  // NOLINT
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerMask + 1, 0);  // NOLINT
+    nodeMask[numaNodeId / bitsPerMask] |= 1ul << (numaNodeId % bitsPerMask);
+
+    return 0 == syscall(SYS_mbind, begin, end - begin, mpolPreferred,
+                        nodeMask.data(), nodeMask.size() * bitsPerMask + 1, mpolMfMove);
+}
+
+std::shared_ptr<void> AllocateOnNumaNode(size_t size, int numaNodeId) {
+    if (size == 0 || numaNodeId < 0 || !isMultiNuma())
+        return nullptr;
+
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+    std::shared_ptr<void> region(ptr, [size](void* p) { munmap(p, size); });
+
+    // anonymous pages are not resident until the first touch, so all of them follow the policy
+    if (!BindToNumaNode(ptr, size, numaNodeId))
+        return nullptr;
+    return region;
+}
+
+bool GetNumaPlacement(const void* ptr, size_t size, std::map<int, uint64_t>& placement) {
+    if (ptr == nullptr || size == 0)
+        return true;
+
+    const auto page = pageSize();
+    const auto begin = reinterpret_cast<uintptr_t>(ptr) / page * page;
+    const auto end = reinterpret_cast<uintptr_t>(ptr) + size;
+
+    std::vector<void*> pages;
+    for (auto addr = begin; addr < end; addr += page)
+        pages.push_back(reinterpret_cast<void*>(addr));
+    std::vector<int> status(pages.size(), -1);
+
+    // move_pages without destination nodes only reports where pages are,
+    // it fails with ENOSYS on kernels without NUMA support
+    if (0 != syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0)) {
+        placement[-1] += size;
+        return false;
+    }
+
+    for (size_t i = 0; i < pages.size(); i++) {
+        // negative status means that the page is not resident yet
+        const int node = status[i] < 0 ? -1 : status[i];
+        const auto pageBegin = std::max(reinterpret_cast<uintptr_t>(pages[i]), reinterpret_cast<uintptr_t>(ptr));
+        const auto pageEnd = std::min(reinterpret_cast<uintptr_t>(pages[i]) + page, end);
+        placement[node] += pageEnd - pageBegin;
+    }
+    return true;
+}
+
+#else
+
+bool BindToNumaNode(const void*, size_t, int) {
+    return false;
+}
+
+std::shared_ptr<void> AllocateOnNumaNode(size_t, int) {
+    return nullptr;
+}
+
+bool GetNumaPlacement(const void* ptr, size_t size, std::map<int, uint64_t>& placement) {
+    if (ptr != nullptr && size != 0)
+        placement[-1] += size;
+    return false;
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
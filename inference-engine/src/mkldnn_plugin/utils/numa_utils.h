@@ -0,0 +1,49 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Sets preferred NUMA node for the memory range. Pages which are not touched yet will be allocated
+ * on this node, pages which are already resident on other nodes are migrated.
+ * Only whole pages inside the range are affected. Does nothing on single node systems.
+ *
+ * @param ptr start of memory range
+ * @param size size of memory range in bytes
+ * @param numaNodeId destination NUMA node
+ * @return true if the memory policy was applied
+ */
+bool BindToNumaNode(const void* ptr, size_t size, int numaNodeId);
+
+/**
+ * Maps a new memory region whose pages are allocated on the NUMA node on the first touch.
+ * Unlike BindToNumaNode on an existing allocation, no page of the region can be faulted in before
+ * the policy is set.
+ *
+ * @param size size of memory region in bytes
+ * @param numaNodeId NUMA node to allocate pages on
+ * @return page aligned region unmapped when the last reference is dropped, nullptr on single node systems
+ * or if the region can not be mapped
+ */
+std::shared_ptr<void> AllocateOnNumaNode(size_t size, int numaNodeId);
+
+/**
+ * Accumulates amount of memory of the range per NUMA node. Memory which is not resident yet
+ * or whose placement can not be queried is accounted under -1 node id
+ *
+ * @param ptr start of memory range
+ * @param size size of memory range in bytes
+ * @param placement map NUMA node id -> bytes to update
+ * @return false if placement of pages can not be queried on this system
+ */
+bool GetNumaPlacement(const void* ptr, size_t size, std::map<int, uint64_t>& placement);
+
+}  // namespace MKLDNNPlugin
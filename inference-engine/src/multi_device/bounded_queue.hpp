@@ -0,0 +1,157 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <utility>
+
+namespace MultiDevicePlugin {
+
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue.
+ *        Every cell has a sequence number which tells producers and consumers whether the cell
+ *        is free for the current lap, so push and pop need a single CAS on the shared position.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size <<= 1;
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Moves the value to the queue
+     * @return false if the queue is full, the value is left untouched in this case
+     */
+    bool try_push(T& value) {
+        Cell* cell = nullptr;
+        std::size_t position = _pushPosition.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[position & _mask];
+            std::size_t sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (diff == 0) {
+                if (_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = _pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        std::size_t position = _popPosition.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[position & _mask];
+            std::size_t sequence = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (diff == 0) {
+                if (_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = _popPosition.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_value = T{};
+        cell->_sequence.store(position + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return _pushPosition.load(std::memory_order_acquire) == _popPosition.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const {
+        return _mask + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+
+    // Producers and consumers update different positions, so they are kept in different cache lines
+    static constexpr std::size_t cacheLineSize = 64;
+
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    char                        _padding0[cacheLineSize];
+    std::atomic<std::size_t>    _pushPosition = {0};
+    char                        _padding1[cacheLineSize];
+    std::atomic<std::size_t>    _popPosition = {0};
+};
+
+/**
+ * @brief Lock-free bounded queue which falls back to a mutex protected queue when the capacity is exceeded,
+ *        so push never fails. Elements are pushed to the overflow queue until it is drained, so FIFO order is kept.
+ */
+template <typename T>
+class ThreadSafeQueue {
+public:
+    explicit ThreadSafeQueue(std::size_t capacity = 64) : _queue{capacity} {}
+
+    void push(T value) {
+        // Elements of the bounded queue are older than elements of the overflow queue
+        if (0 == _overflowSize.load() && _queue.try_push(value)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        _overflow.push(std::move(value));
+        _overflowSize++;
+    }
+
+    bool try_pop(T& value) {
+        if (_queue.try_pop(value)) {
+            return true;
+        }
+        if (0 == _overflowSize.load()) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_overflow.empty()) {
+            return false;
+        }
+        value = std::move(_overflow.front());
+        _overflow.pop();
+        _overflowSize--;
+        return true;
+    }
+
+    bool empty() const {
+        return _queue.empty() && 0 == _overflowSize.load();
+    }
+
+protected:
+    BoundedQueue<T>             _queue;
+    std::mutex                  _mutex;
+    std::queue<T>               _overflow;
+    std::atomic<std::size_t>    _overflowSize = {0};
+};
+
+}  // namespace MultiDevicePlugin
@@ -5,9 +5,11 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <utility>
+#include <tuple>
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
@@ -79,7 +81,15 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
             workerInferRequest->_task = std::move(task);
-            workerInferRequest->_inferRequest.StartAsync();
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
+            // the completion callback decrements the counter, so it is counted only if the request has started
+            workerInferRequest->_deviceStatistics->busyRequests++;
+            try {
+                workerInferRequest->_inferRequest.StartAsync();
+            } catch (...) {
+                workerInferRequest->_deviceStatistics->busyRequests--;
+                throw;
+            }
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
     };
@@ -150,6 +160,9 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    _schedulingPolicy = CreateSchedulingPolicy(_config.end() == itPolicy ? MULTI_CONFIG_VALUE(PRIORITY)
+                                                                         : itPolicy->second.as<std::string>());
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -167,17 +180,24 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
         const auto numRequests = (_devicePriorities.end() == itNumRequests ||
             itNumRequests->second.numRequestsPerDevices == -1) ? optimalNum : itNumRequests->second.numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
-        auto& idleWorkerRequests = _idleWorkerRequests[device];
+        auto& idleWorkerRequests = _idleWorkerRequests.emplace(std::piecewise_construct,
+                                                               std::forward_as_tuple(device),
+                                                               std::forward_as_tuple(numRequests)).first->second;
         workerRequests.resize(numRequests);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
+        auto* deviceStatisticsPtr = &(_deviceStatistics[device]);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
+            workerRequest._deviceStatistics = deviceStatisticsPtr;
             auto* workerRequestPtr = &workerRequest;
             idleWorkerRequests.push(workerRequestPtr);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, deviceStatisticsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    deviceStatisticsPtr->AddLatency(std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count());
+                    deviceStatisticsPtr->busyRequests--;
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -192,12 +212,25 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
 }
 
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
-    auto devices = [&] {
+    std::vector<DeviceCandidate> candidates;
+    SchedulingPolicy::Ptr schedulingPolicy;
+    {
         std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
-    for (auto&& device : devices) {
-        auto& idleWorkerRequests = _idleWorkerRequests[device.first];
+        schedulingPolicy = _schedulingPolicy;
+        for (auto&& device : _devicePriorities) {
+            auto& statistics = _deviceStatistics.at(device.first);
+            candidates.push_back({device.first, device.second.priority,
+                                  static_cast<unsigned int>(_workerRequests.at(device.first).size()),
+                                  statistics.busyRequests.load(), statistics.latencyMs.load()});
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [] (const DeviceCandidate& lhs, const DeviceCandidate& rhs) {
+        return lhs.priority < rhs.priority;
+    });
+    schedulingPolicy->SelectDevices(candidates);
+
+    for (auto&& candidate : candidates) {
+        auto& idleWorkerRequests = _idleWorkerRequests.at(candidate.device);
         WorkerInferRequest* workerRequestPtr = nullptr;
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
@@ -250,13 +283,19 @@ void MultiDeviceExecutableNetwork::CreateInferRequest(IInferRequest::Ptr& asyncR
 void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config,
         InferenceEngine::ResponseDesc * /* resp */) {
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
-    if (priorities == config.end() || config.size() > 1) {
+    auto policy = config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    const size_t numSupportedKeys = (priorities != config.end()) + (policy != config.end());
+    if (numSupportedKeys == 0 || config.size() > numSupportedKeys) {
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str <<
-            "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
-    } else {
+            "The only configs supported for the Network's SetConfig are MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES"
+            " and MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY";
+    }
+
+    DeviceMap<DeviceInformation> metaDevices;
+    if (priorities != config.end()) {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
-        auto metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
+        metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
 
         if (std::any_of(metaDevices.begin(), metaDevices.end(), [](const std::pair<DeviceName, DeviceInformation> & kvp) {
                 return kvp.second.numRequestsPerDevices != -1;
@@ -264,9 +303,15 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "You can only change device priorities but not number of requests"
                      <<" with the Network's SetConfig(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES!";
         }
+    }
+    SchedulingPolicy::Ptr schedulingPolicy;
+    if (policy != config.end()) {
+        schedulingPolicy = CreateSchedulingPolicy(policy->second.as<std::string>());
+    }
 
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (priorities != config.end()) {
             for (auto && device : metaDevices) {
                 if (_networksPerDevice.find(device.first) == _networksPerDevice.end()) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "You can only change device priorities but not add new devices with"
@@ -279,7 +324,13 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
         }
+        if (schedulingPolicy) {
+            _schedulingPolicy = schedulingPolicy;
+            _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = policy->second;
+        }
     }
+    // Requests waiting for a busy device may be schedulable with the new settings
+    ScheduleToWorkerInferRequest();
 }
 
 void MultiDeviceExecutableNetwork::GetConfig(const std::string &name, InferenceEngine::Parameter &result,
@@ -316,11 +367,23 @@ void MultiDeviceExecutableNetwork::GetMetric(const std::string &name, Parameter
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            MULTI_METRIC(DEVICE_STATISTICS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == MULTI_METRIC(DEVICE_STATISTICS)) {
+        std::map<std::string, std::map<std::string, double>> statistics;
+        for (auto&& device : _deviceStatistics) {
+            auto& deviceStatistics = statistics[device.first];
+            deviceStatistics["LATENCY_MS"] = device.second.latencyMs;
+            deviceStatistics["QUEUE_DEPTH"] = device.second.busyRequests;
+            deviceStatistics["NUM_REQUESTS"] = static_cast<double>(_workerRequests.at(device.first).size());
+            deviceStatistics["COMPLETED_REQUESTS"] = static_cast<double>(device.second.completedRequests);
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_STATISTICS, statistics);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
     }
@@ -383,7 +446,8 @@ DeviceMap<DeviceInformation> MultiDeviceInferencePlugin::ParseMetaDevices(const
         return GetSupportedConfig(tconfig, deviceName);
     };
 
-    for (auto && d : devicesWithRequests) {
+    for (size_t priority = 0; priority < devicesWithRequests.size(); priority++) {
+        auto & d = devicesWithRequests[priority];
         auto openingBracket = d.find_first_of('(');
         auto closingBracket = d.find_first_of(')', openingBracket);
         auto device_name = d.substr(0, openingBracket);
@@ -399,7 +463,7 @@ DeviceMap<DeviceInformation> MultiDeviceInferencePlugin::ParseMetaDevices(const
         }
 
         // create meta device
-        metaDevices[device_name] = { getDeviceConfig(device_name), numRequests };
+        metaDevices[device_name] = { getDeviceConfig(device_name), numRequests, static_cast<int>(priority) };
     }
 
     return metaDevices;
@@ -414,6 +478,9 @@ Parameter MultiDeviceInferencePlugin::GetConfig(const std::string& name,
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MULTI_CONFIG_VALUE(PRIORITY)} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -456,7 +523,8 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
         std::string name = { "MULTI" };
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, name);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
@@ -481,6 +549,13 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
 
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != fullConfig.end()) {
+        // check the value before networks are loaded to devices
+        CreateSchedulingPolicy(policy->second);
+        multiNetworkConfig.insert(*policy);
+    }
+
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     for (auto& p : metaDevices) {
         auto & deviceName = p.first;
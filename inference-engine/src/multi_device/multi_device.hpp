@@ -6,8 +6,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
-#include <queue>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -21,18 +21,15 @@
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include <ie_parallel.hpp>
-
-#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
-# include <tbb/concurrent_queue.h>
-#endif
+#include "bounded_queue.hpp"
+#include "scheduling_policy.hpp"
 
 namespace MultiDevicePlugin {
 
-using DeviceName = std::string;
-
 struct DeviceInformation {
     std::map<std::string, std::string> config;
     int numRequestsPerDevices;
+    int priority;
 };
 
 template<typename T>
@@ -53,40 +50,6 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::InferRequest& req);
 };
 
-#if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
-template <typename T>
-using ThreadSafeQueue = tbb::concurrent_queue<T>;
-#else
-template <typename T>
-class ThreadSafeQueue {
-public:
-    void push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push(std::move(value));
-    }
-
-    bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (!_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
-            return false;
-        }
-    }
-
-    bool empty() {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _queue.empty();
-    }
-
-protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-};
-#endif
-
 class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault,
                                      public ITaskExecutor {
 public:
@@ -95,6 +58,8 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         Task                            _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
+        DeviceStatistics*               _deviceStatistics = nullptr;
     };
     using NotBusyWorkerRequests = ThreadSafeQueue<WorkerInferRequest*>;
 
@@ -118,6 +83,8 @@ public:
     std::atomic_bool                                            _terminate = {false};
     std::mutex                                                  _mutex;
     DeviceMap<DeviceInformation>                                _devicePriorities;
+    SchedulingPolicy::Ptr                                       _schedulingPolicy;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
     ThreadSafeQueue<Task>                                       _inferPipelineTasks;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
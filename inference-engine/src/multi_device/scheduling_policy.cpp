@@ -0,0 +1,97 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <details/ie_exception.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include "scheduling_policy.hpp"
+
+namespace MultiDevicePlugin {
+using namespace InferenceEngine;
+
+void DeviceStatistics::AddLatency(double sampleMs) {
+    // Weight of the last sample: recent device load matters more than the history
+    constexpr double alpha = 0.125;
+    double average = latencyMs.load();
+    double updated = 0.0;
+    do {
+        updated = average == 0.0 ? sampleMs : average + alpha * (sampleMs - average);
+    } while (!latencyMs.compare_exchange_weak(average, updated));
+    completedRequests++;
+}
+
+namespace {
+
+bool HasIdleRequest(const DeviceCandidate& candidate) {
+    return candidate.busyRequests < candidate.numRequests;
+}
+
+class PrioritySchedulingPolicy : public SchedulingPolicy {
+public:
+    void SelectDevices(std::vector<DeviceCandidate>&) const override {}
+};
+
+class EarliestCompletionSchedulingPolicy : public SchedulingPolicy {
+public:
+    void SelectDevices(std::vector<DeviceCandidate>& candidates) const override {
+        // Idle devices without measurements yet are tried first, so every device gets measured
+        auto unmeasuredEnd = std::stable_partition(candidates.begin(), candidates.end(), [] (const DeviceCandidate& candidate) {
+            return IsUnmeasured(candidate) && HasIdleRequest(candidate);
+        });
+        // A request sent to an idle device completes after its latency, while a busy device
+        // gets free on average after latency divided by number of its parallel requests.
+        // Completion on a busy device without measurements is unknown, so it is never waited for.
+        auto expectedCompletion = [] (const DeviceCandidate& candidate) {
+            if (IsUnmeasured(candidate))
+                return std::numeric_limits<double>::infinity();
+            return HasIdleRequest(candidate) ? candidate.latencyMs
+                                             : candidate.latencyMs + candidate.latencyMs / candidate.numRequests;
+        };
+        std::stable_sort(unmeasuredEnd, candidates.end(), [&] (const DeviceCandidate& lhs, const DeviceCandidate& rhs) {
+            return expectedCompletion(lhs) < expectedCompletion(rhs);
+        });
+        // Waiting for a busy device is better than sending the request to any device after it
+        auto firstBusy = std::find_if_not(candidates.begin(), candidates.end(), HasIdleRequest);
+        candidates.erase(firstBusy, candidates.end());
+    }
+
+private:
+    static bool IsUnmeasured(const DeviceCandidate& candidate) {
+        return candidate.latencyMs == 0.0;
+    }
+};
+
+class ThroughputProportionalSchedulingPolicy : public SchedulingPolicy {
+public:
+    void SelectDevices(std::vector<DeviceCandidate>& candidates) const override {
+        // Throughput of a device is numRequests / latency, so the device with the lowest
+        // load relative to its throughput gets the request
+        auto relativeLoad = [] (const DeviceCandidate& candidate) {
+            return (candidate.busyRequests + 1) * candidate.latencyMs / candidate.numRequests;
+        };
+        std::stable_sort(candidates.begin(), candidates.end(), [&] (const DeviceCandidate& lhs, const DeviceCandidate& rhs) {
+            return relativeLoad(lhs) < relativeLoad(rhs);
+        });
+    }
+};
+
+}  // namespace
+
+SchedulingPolicy::Ptr CreateSchedulingPolicy(const std::string& name) {
+    if (name == MULTI_CONFIG_VALUE(PRIORITY)) {
+        return std::make_shared<PrioritySchedulingPolicy>();
+    } else if (name == MULTI_CONFIG_VALUE(EARLIEST_COMPLETION)) {
+        return std::make_shared<EarliestCompletionSchedulingPolicy>();
+    } else if (name == MULTI_CONFIG_VALUE(THROUGHPUT_PROPORTIONAL)) {
+        return std::make_shared<ThroughputProportionalSchedulingPolicy>();
+    }
+    THROW_IE_EXCEPTION << "Unsupported " << MULTI_CONFIG_KEY(SCHEDULING_POLICY) << " value: " << name;
+}
+
+}  // namespace MultiDevicePlugin
@@ -0,0 +1,62 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MultiDevicePlugin {
+
+using DeviceName = std::string;
+
+/**
+ * @brief Runtime statistics of worker infer requests of a device. Updated from completion callbacks without locks
+ */
+struct DeviceStatistics {
+    void AddLatency(double latencyMs);
+
+    std::atomic<unsigned int>   busyRequests = {0};
+    std::atomic<std::uint64_t>  completedRequests = {0};
+    // Exponentially weighted moving average, 0 until the first request is completed
+    std::atomic<double>         latencyMs = {0.0};
+};
+
+/**
+ * @brief State of a device at the moment of scheduling
+ */
+struct DeviceCandidate {
+    DeviceName      device;
+    int             priority;       // position in the DEVICE_PRIORITIES list, 0 is the highest
+    unsigned int    numRequests;
+    unsigned int    busyRequests;
+    double          latencyMs;
+};
+
+/**
+ * @brief Chooses devices for the next infer request of MULTI executable network
+ */
+class SchedulingPolicy {
+public:
+    using Ptr = std::shared_ptr<SchedulingPolicy>;
+    virtual ~SchedulingPolicy() = default;
+
+    /**
+     * @brief Orders devices in which idle worker requests are looked for. Devices which should not get
+     *        the request right now are removed, so the request waits in the queue until one of them is free.
+     * @param candidates All devices of the network, filled in priority order
+     */
+    virtual void SelectDevices(std::vector<DeviceCandidate>& candidates) const = 0;
+};
+
+/**
+ * @brief Creates policy by MULTI_SCHEDULING_POLICY config value
+ */
+SchedulingPolicy::Ptr CreateSchedulingPolicy(const std::string& name);
+
+}  // namespace MultiDevicePlugin
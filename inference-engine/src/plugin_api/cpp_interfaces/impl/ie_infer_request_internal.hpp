@@ -67,7 +67,8 @@ public:
      * @brief Given optional implementation of setting blob to avoid need for it to be implemented by plugin
      * @param name - a name of input or output blob.
      * @param data - a reference to input or output blob. The type of Blob must correspond to the network input
-     * precision and size.
+     * precision and size. U8 input blob is also accepted for FP32 or BF16 network input if pre-processing is set,
+     * then it is converted by pre-processing.
      */
     void SetBlob(const char* name, const Blob::Ptr& data) override {
         OV_ITT_SCOPED_TASK(itt::domains::Plugin, "SetBlob");
@@ -86,12 +87,13 @@ public:
         DataPtr foundOutput;
         size_t dataSize = data->size();
         if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
-            if (foundInput->getPrecision() != data->getTensorDesc().getPrecision()) {
+            const bool preProcRequired = preProcessingRequired(foundInput, data);
+            if (foundInput->getPrecision() != data->getTensorDesc().getPrecision() &&
+                !(preProcRequired && preProcessingConvertsPrecision(foundInput, data))) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                    << "Failed to set Blob with precision not corresponding to user input precision";
             }
 
-            const bool preProcRequired = preProcessingRequired(foundInput, data);
             if (compoundBlobPassed && !preProcRequired) {
                 THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                    << "cannot set compound blob: supported only for input pre-processing";
@@ -99,7 +101,10 @@ public:
 
             if (preProcRequired) {
                 if (_preProcData.find(name) == _preProcData.end()) {
-                    _preProcData.emplace(name, CreatePreprocDataHelper());
+                    auto preProcData = CreatePreprocDataHelper();
+                    // requests of an executable network share compiled pre-processing graphs
+                    preProcData->setCacheOwner(_exeNetwork.get());
+                    _preProcData.emplace(name, preProcData);
                 }
                 _preProcData[name]->isApplicable(data, _inputs[name]);
                 // Stores the given blob as ROI blob. It will be used to fill in network input
@@ -234,8 +239,13 @@ public:
             // using preconfigured resize algorithm.
             auto it = _preProcData.find(input.first);
             if (it != _preProcData.end()) {
-                _preProcData[input.first]->execute(input.second, _networkInputs[input.first]->getPreProcess(), serial,
-                                                   m_curBatch);
+                // mean and scale are applied by the plugin, so they are not passed to pre-processing
+                const auto& info = _networkInputs[input.first]->getPreProcess();
+                PreProcessInfo resizeInfo;
+                resizeInfo.setResizeAlgorithm(info.getResizeAlgorithm());
+                resizeInfo.setColorFormat(info.getColorFormat());
+                resizeInfo.setLetterbox(info.getLetterbox(), info.getPadValue());
+                it->second->execute(input.second, resizeInfo, serial, m_curBatch);
             }
         }
     }
@@ -368,6 +378,18 @@ protected:
                (colorFormatSpecified && inputColorFormat != networkColorFormat) ||
                (colorFormatSpecified && info->getLayout() != blob->getTensorDesc().getLayout());
     }
+
+    /**
+     * @brief Checks whether pre-processing converts a given input blob into network input of other precision
+     * @param info InputInfo corresponding to input blob
+     * @param blob Input Blob object corresponding to input info
+     * @return `True` if U8 blob is set for FP32 or BF16 network input, `false` otherwise
+     */
+    static bool preProcessingConvertsPrecision(const InputInfo::Ptr& info, const Blob::Ptr& blob) {
+        const auto networkPrecision = info->getPrecision();
+        return blob->getTensorDesc().getPrecision() == Precision::U8 &&
+               (networkPrecision == Precision::FP32 || networkPrecision == Precision::BF16);
+    }
 };
 
 }  // namespace InferenceEngine
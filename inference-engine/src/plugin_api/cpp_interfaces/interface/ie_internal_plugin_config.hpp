@@ -26,12 +26,25 @@ namespace PluginConfigInternalParams {
  */
 #define CONFIG_KEY_INTERNAL(name)  ::InferenceEngine::PluginConfigInternalParams::_CONFIG_KEY(name)
 
+/**
+ * @def CONFIG_VALUE_INTERNAL(name)
+ * @ingroup ie_dev_api_plugin_api
+ * @brief Shortcut for defining internal configuration values
+ */
+#define CONFIG_VALUE_INTERNAL(name)  ::InferenceEngine::PluginConfigInternalParams::name
+
 /**
  * @brief Defines a low precision mode key
  * @ingroup ie_dev_api_plugin_api
  */
 DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
 
+/**
+ * @brief Enables execution of independent graph branches in parallel inside the CPU plugin stream: YES or NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLEL);
+
 /**
  * @brief This key should be used to mark input executable subnetworks
  * @ingroup ie_dev_api_plugin_api
@@ -44,6 +57,16 @@ DECLARE_CONFIG_KEY(SUBNETWORK_WITH_NETWORK_INPUTS);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Defines priority class of inference tasks of an executable network in CPU Executor Streams shared with
+ *        other networks: REALTIME, NORMAL (default) or BULK
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_TASK_PRIORITY);
+DECLARE_CONFIG_VALUE(REALTIME);
+DECLARE_CONFIG_VALUE(NORMAL);
+DECLARE_CONFIG_VALUE(BULK);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -20,7 +20,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Each stream thread pulls tasks from its own queue and steals tasks from other streams
+ *        when the queue is empty. Tasks of higher IStreamsExecutor::TaskPriority class are executed first.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -42,6 +43,8 @@ public:
 
     void run(Task task) override;
 
+    void run(Task task, TaskPriority priority) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
@@ -44,6 +44,16 @@ public:
         NUMA     //!< Bind threads to NUMA nodes
     };
 
+    /**
+     * @brief Defines priority class of a task. Tasks of a higher priority class are always taken
+     *        from the queues before tasks of a lower one
+     */
+    enum TaskPriority : std::uint8_t {
+        REALTIME,  //!< Latency critical tasks
+        NORMAL,    //!< Default priority
+        BULK       //!< Throughput oriented tasks that can wait
+    };
+
     /**
      * @brief Defines IStreamsExecutor configuration
      */
@@ -130,6 +140,16 @@ public:
     */
     virtual int  GetNumaNodeId() = 0;
 
+    using ITaskExecutor::run;
+
+    /**
+    * @brief Execute the task with the specified priority class. ITaskExecutor::run executes tasks with
+    *        TaskPriority::NORMAL class. The default implementation ignores the priority
+    * @param task A task to start
+    * @param priority A priority class of the task
+    */
+    virtual void run(Task task, TaskPriority priority);
+
     /**
     * @brief Execute the task in the current thread using streams executor configuration and constraints
     * @param task A task to start
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_priority_executor.hpp
+ * @brief A header file for Inference Engine Priority Executor implementation
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Task executor implementation that submits tasks to a shared streams executor with a fixed priority class.
+ *        Allows to use IStreamsExecutor::run(Task, TaskPriority) as a stage executor of an infer request pipeline,
+ *        so requests of different priority share the same streams
+ * @ingroup ie_dev_api_threading
+ */
+class PriorityExecutor: public ITaskExecutor {
+public:
+    /**
+     * @brief A shared pointer to a PriorityExecutor object
+     */
+    using Ptr = std::shared_ptr<PriorityExecutor>;
+
+    /**
+     * @brief Constructs the executor
+     * @param executor A streams executor to run tasks
+     * @param priority A priority class of tasks
+     */
+    PriorityExecutor(const IStreamsExecutor::Ptr& executor, IStreamsExecutor::TaskPriority priority) :
+        _executor{executor},
+        _priority{priority} {
+    }
+
+    /**
+     * @brief Destroys the object.
+     */
+    ~PriorityExecutor() override = default;
+
+    /**
+     * @brief Changes a priority class of tasks submitted after the call
+     * @param priority A priority class of tasks
+     */
+    void SetPriority(IStreamsExecutor::TaskPriority priority) {
+        _priority = priority;
+    }
+
+    void run(Task task) override {
+        _executor->run(std::move(task), _priority);
+    }
+
+private:
+    IStreamsExecutor::Ptr                        _executor;
+    std::atomic<IStreamsExecutor::TaskPriority>  _priority;
+};
+
+}  // namespace InferenceEngine
@@ -126,6 +126,14 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void normalizeRow_8U32F(const uint8_t in[], float out[], int length, float mean, float scale) {
+    normalizeRow_8U32F_impl(in, out, length, mean, scale);
+}
+
+void normalizeRow_8UBF16(const uint8_t in[], uint16_t out[], int length, float mean, float scale) {
+    normalizeRow_8UBF16_impl(in, out, length, mean, scale);
+}
+
 }  // namespace neon
 }  // namespace kernels
 }  // namespace gapi
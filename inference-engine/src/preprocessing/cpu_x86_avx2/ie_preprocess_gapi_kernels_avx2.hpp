@@ -201,6 +201,10 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void normalizeRow_8U32F(const uint8_t in[], float out[], int length, float mean, float scale);
+
+void normalizeRow_8UBF16(const uint8_t in[], uint16_t out[], int length, float mean, float scale);
+
 }  // namespace avx
 }  // namespace kernels
 }  // namespace gapi
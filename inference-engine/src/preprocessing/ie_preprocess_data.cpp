@@ -402,6 +402,119 @@ inline int clip(int x, int a, int b) {
     return x >= a ? (x < b ? x : b-1) : a;
 }
 
+template<typename data_t = float>
+void resize_nearest(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+    auto dstDims = outBlob->getTensorDesc().getDims();
+    auto srcDims = inBlob->getTensorDesc().getDims();
+
+    auto dwidth = static_cast<const int>(dstDims[3]);
+    auto dheight = static_cast<const int>(dstDims[2]);
+    auto swidth = static_cast<const int>(srcDims[3]);
+    auto sheight = static_cast<const int>(srcDims[2]);
+    auto channels = static_cast<const int>(srcDims[1]);
+
+    auto src_strides = inBlob->getTensorDesc().getBlockingDesc().getStrides();
+    auto dst_strides = outBlob->getTensorDesc().getBlockingDesc().getStrides();
+
+    auto *sptr = static_cast<data_t*>(inBlob->buffer()) + inBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    auto *dptr = static_cast<data_t*>(outBlob->buffer()) + outBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    auto scale_x = static_cast<double>(swidth) / dwidth;
+    auto scale_y = static_cast<double>(sheight) / dheight;
+
+    auto* xofs = reinterpret_cast<int32_t*>(buffer);
+    for (int dx = 0; dx < dwidth; dx++) {
+        xofs[dx] = (std::min)(static_cast<int32_t>(dx * scale_x), swidth - 1);
+    }
+
+    for (int c = 0; c < channels; c++) {
+        for (int dy = 0; dy < dheight; dy++) {
+            int32_t sy = (std::min)(static_cast<int32_t>(dy * scale_y), sheight - 1);
+            const data_t* srow = sptr + c * src_strides[1] + sy * src_strides[2];
+            data_t* drow = dptr + c * dst_strides[1] + dy * dst_strides[2];
+
+            for (int dx = 0; dx < dwidth; dx++) {
+                drow[dx] = srow[xofs[dx]];
+            }
+        }
+    }
+}
+
+// Coefficients of cubic convolution for 4 neighbouring pixels, A = -0.75 is the same as in OpenCV
+static inline void interpolate_cubic(float x, float* coeffs) {
+    const float A = -0.75f;
+
+    coeffs[0] = ((A * (x + 1) - 5 * A) * (x + 1) + 8 * A) * (x + 1) - 4 * A;
+    coeffs[1] = ((A + 2) * x - (A + 3)) * x * x + 1;
+    coeffs[2] = ((A + 2) * (1 - x) - (A + 3)) * (1 - x) * (1 - x) + 1;
+    coeffs[3] = 1.f - coeffs[0] - coeffs[1] - coeffs[2];
+}
+
+template<typename data_t = float>
+void resize_bicubic(const Blob::Ptr inBlob, Blob::Ptr outBlob, uint8_t* buffer) {
+    auto dstDims = outBlob->getTensorDesc().getDims();
+    auto srcDims = inBlob->getTensorDesc().getDims();
+
+    auto dwidth = static_cast<const int>(dstDims[3]);
+    auto dheight = static_cast<const int>(dstDims[2]);
+    auto swidth = static_cast<const int>(srcDims[3]);
+    auto sheight = static_cast<const int>(srcDims[2]);
+    auto channels = static_cast<const int>(srcDims[1]);
+
+    auto src_strides = inBlob->getTensorDesc().getBlockingDesc().getStrides();
+    auto dst_strides = outBlob->getTensorDesc().getBlockingDesc().getStrides();
+
+    auto *sptr = static_cast<data_t*>(inBlob->buffer()) + inBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    auto *dptr = static_cast<data_t*>(outBlob->buffer()) + outBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    auto scale_x = static_cast<float>(swidth) / dwidth;
+    auto scale_y = static_cast<float>(sheight) / dheight;
+
+    // 4 source indices with replicated border and 4 coefficients for every destination column and row
+    auto* xofs = reinterpret_cast<int32_t*>(buffer);
+    auto* yofs = xofs + 4 * dwidth;
+    auto* alpha = reinterpret_cast<float*>(yofs + 4 * dheight);
+    auto* beta = alpha + 4 * dwidth;
+    auto* tptr = beta + 4 * dheight;
+
+    auto compute_taps = [](int dsize, int ssize, float scale, int32_t* ofs, float* coeffs) {
+        for (int d = 0; d < dsize; d++) {
+            auto f = static_cast<float>((d + 0.5) * scale - 0.5);
+            auto s = static_cast<int32_t>(std::floor(f));
+            interpolate_cubic(f - s, coeffs + 4 * d);
+            for (int k = 0; k < 4; k++) {
+                ofs[4 * d + k] = clip(s - 1 + k, 0, ssize);
+            }
+        }
+    };
+    compute_taps(dwidth, swidth, scale_x, xofs, alpha);
+    compute_taps(dheight, sheight, scale_y, yofs, beta);
+
+    for (int c = 0; c < channels; c++) {
+        const data_t* splane = sptr + c * src_strides[1];
+        data_t* dplane = dptr + c * dst_strides[1];
+
+        for (int dy = 0; dy < dheight; dy++) {
+            // vertical pass over the whole source row, then horizontal pass over its result
+            const data_t* s0 = splane + yofs[4 * dy + 0] * src_strides[2];
+            const data_t* s1 = splane + yofs[4 * dy + 1] * src_strides[2];
+            const data_t* s2 = splane + yofs[4 * dy + 2] * src_strides[2];
+            const data_t* s3 = splane + yofs[4 * dy + 3] * src_strides[2];
+            const float* b = beta + 4 * dy;
+
+            for (int x = 0; x < swidth; x++) {
+                tptr[x] = b[0] * s0[x] + b[1] * s1[x] + b[2] * s2[x] + b[3] * s3[x];
+            }
+
+            data_t* drow = dplane + dy * dst_strides[2];
+            for (int dx = 0; dx < dwidth; dx++) {
+                const int32_t* xo = xofs + 4 * dx;
+                const float* a = alpha + 4 * dx;
+                float res = a[0] * tptr[xo[0]] + a[1] * tptr[xo[1]] + a[2] * tptr[xo[2]] + a[3] * tptr[xo[3]];
+                drow[dx] = saturate_cast<data_t>(res);
+            }
+        }
+    }
+}
+
 const int MAX_ESIZE = 16;
 
 template<typename data_t>
@@ -660,12 +773,27 @@ size_t resize_get_buffer_size(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeA
         return buffer_size;
     };
 
+    auto resize_nearest_buffer_size = [&]() {
+        return sizeof(int32_t) * dstDims[3];
+    };
+
+    auto resize_bicubic_buffer_size = [&]() {
+        size_t buffer_size = (sizeof(int32_t) + sizeof(float)) * 4 * (dstDims[3] + dstDims[2]) +
+                             sizeof(float) * srcDims[3];
+
+        return buffer_size;
+    };
+
     if (algorithm == RESIZE_BILINEAR) {
         if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
             return resize_bilinear_u8_buffer_size();
         } else {
             return resize_bilinear_fp32_buffer_size();
         }
+    } else if (algorithm == RESIZE_NEAREST) {
+        return resize_nearest_buffer_size();
+    } else if (algorithm == RESIZE_BICUBIC) {
+        return resize_bicubic_buffer_size();
     } else if (algorithm == RESIZE_AREA) {
         if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
             if (scale_x <= 1 && scale_y <= 1) {
@@ -697,7 +825,8 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
           (inBlob->getTensorDesc().getPrecision() == Precision::FP32 && outBlob->getTensorDesc().getPrecision() == Precision::FP32)))
         THROW_IE_EXCEPTION << "Resize supports only U8 and FP32 precisions";
 
-    if (algorithm != RESIZE_BILINEAR && algorithm != RESIZE_AREA)
+    if (algorithm != RESIZE_BILINEAR && algorithm != RESIZE_AREA &&
+        algorithm != RESIZE_NEAREST && algorithm != RESIZE_BICUBIC)
         THROW_IE_EXCEPTION << "Unsupported resize algorithm type";
 
     size_t buffer_size = resize_get_buffer_size(inBlob, outBlob, algorithm);
@@ -722,6 +851,18 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
         } else {
             resize_bilinear<float>(inBlob, outBlob, buffer);
         }
+    } else if (algorithm == RESIZE_NEAREST) {
+        if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
+            resize_nearest<uint8_t>(inBlob, outBlob, buffer);
+        } else {
+            resize_nearest<float>(inBlob, outBlob, buffer);
+        }
+    } else if (algorithm == RESIZE_BICUBIC) {
+        if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
+            resize_bicubic<uint8_t>(inBlob, outBlob, buffer);
+        } else {
+            resize_bicubic<float>(inBlob, outBlob, buffer);
+        }
     } else if (algorithm == RESIZE_AREA) {
         if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
             if (scale_x <= 1 && scale_y <= 1) {
@@ -751,6 +892,129 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
 
 using namespace Resize;
 
+namespace {
+
+SizeVector get_image_dims(const Blob::Ptr& blob) {
+    // for YUV420 inputs the image size is the size of Y plane
+    if (auto nv12Blob = as<NV12Blob>(blob)) {
+        return nv12Blob->y()->getTensorDesc().getDims();
+    }
+    if (auto i420Blob = as<I420Blob>(blob)) {
+        return i420Blob->y()->getTensorDesc().getDims();
+    }
+    return blob->getTensorDesc().getDims();
+}
+
+// Descriptor of the part of the network input the image is resized to, shares memory with the input
+TensorDesc make_letterbox_desc(const TensorDesc& desc, const LetterboxTransform& transform) {
+    const auto& blkDesc = desc.getBlockingDesc();
+    const auto& order = blkDesc.getOrder();
+    const auto& strides = blkDesc.getStrides();
+
+    auto dims = desc.getDims();
+    dims[2] = transform.height;
+    dims[3] = transform.width;
+    const SizeVector start = {0, 0, transform.offsetY, transform.offsetX};
+
+    SizeVector blkDims(order.size());
+    SizeVector dimOffsets = blkDesc.getOffsetPaddingToData();
+    size_t offset = blkDesc.getOffsetPadding();
+    for (size_t i = 0; i < order.size(); i++) {
+        blkDims[i] = dims[order[i]];
+        dimOffsets[i] += start[order[i]];
+        offset += start[order[i]] * strides[i];
+    }
+
+    return TensorDesc(desc.getPrecision(), dims, BlockingDesc(blkDims, order, offset, dimOffsets, strides));
+}
+
+template<typename data_t>
+void fill_letterbox_pad(const Blob::Ptr& blob, const LetterboxTransform& transform, data_t value, int batchSize) {
+    const auto& desc = blob->getTensorDesc();
+    const auto& blkDesc = desc.getBlockingDesc();
+    const auto& dims = desc.getDims();
+
+    // strides in NCHW order regardless of the layout
+    SizeVector strides(4);
+    for (size_t i = 0; i < 4; i++) {
+        strides[blkDesc.getOrder()[i]] = blkDesc.getStrides()[i];
+    }
+
+    auto* ptr = static_cast<data_t*>(blob->buffer()) + blkDesc.getOffsetPadding();
+    const size_t height = dims[2];
+    const size_t width = dims[3];
+
+    for (size_t n = 0; n < static_cast<size_t>(batchSize); n++) {
+        for (size_t c = 0; c < dims[1]; c++) {
+            for (size_t y = 0; y < height; y++) {
+                auto* row = ptr + n * strides[0] + c * strides[1] + y * strides[2];
+                auto fill = [&](size_t from, size_t to) {
+                    for (size_t x = from; x < to; x++) {
+                        row[x * strides[3]] = value;
+                    }
+                };
+
+                if (y < transform.offsetY || y >= transform.offsetY + transform.height) {
+                    fill(0, width);
+                } else {
+                    fill(0, transform.offsetX);
+                    fill(transform.offsetX + transform.width, width);
+                }
+            }
+        }
+    }
+}
+
+Blob::Ptr make_letterbox_blob(const Blob::Ptr& roiBlob, const Blob::Ptr& outBlob, float padValue, int batchSize) {
+    const auto& outDesc = outBlob->getTensorDesc();
+    if (outDesc.getLayout() != NCHW && outDesc.getLayout() != NHWC) {
+        THROW_IE_EXCEPTION << "Letterbox resize supports only NCHW and NHWC layouts";
+    }
+
+    const auto srcDims = get_image_dims(roiBlob);
+    const auto& dstDims = outDesc.getDims();
+    const auto transform = PreProcessInfo::getLetterboxTransform(srcDims[3], srcDims[2], dstDims[3], dstDims[2]);
+    if (transform.width == dstDims[3] && transform.height == dstDims[2]) {
+        return outBlob;
+    }
+
+    const auto letterboxDesc = make_letterbox_desc(outDesc, transform);
+    switch (outDesc.getPrecision()) {
+    case Precision::U8:
+        fill_letterbox_pad<uint8_t>(outBlob, transform, saturate_cast<uint8_t>(padValue), batchSize);
+        return make_shared_blob<uint8_t>(letterboxDesc, static_cast<uint8_t*>(outBlob->buffer()));
+    case Precision::FP32:
+        fill_letterbox_pad<float>(outBlob, transform, padValue, batchSize);
+        return make_shared_blob<float>(letterboxDesc, static_cast<float*>(outBlob->buffer()));
+    default:
+        THROW_IE_EXCEPTION << "Letterbox resize supports only U8 and FP32 precisions";
+    }
+}
+
+// G-API normalizes U8 image only while converting it into floating point network input,
+// otherwise mean and scale are applied by a plugin on the network input
+std::vector<float> get_normalization(const Blob::Ptr& roiBlob, const Blob::Ptr& outBlob, const PreProcessInfo& info) {
+    const bool convert = roiBlob->getTensorDesc().getPrecision() == Precision::U8 &&
+                         outBlob->getTensorDesc().getPrecision() != Precision::U8;
+    const auto channels = info.getNumberOfChannels();
+    if (!convert || channels == 0) {
+        return {};
+    }
+    if (info.getMeanVariant() == MEAN_IMAGE) {
+        THROW_IE_EXCEPTION << "Mean image is not supported by pre-processing of U8 image into "
+                           << outBlob->getTensorDesc().getPrecision() << " network input";
+    }
+
+    std::vector<float> normalization(2 * channels);
+    for (size_t c = 0; c < channels; c++) {
+        normalization[c] = info.getMeanVariant() == MEAN_VALUE ? info[c]->meanValue : 0.f;
+        normalization[channels + c] = info[c]->stdScale;
+    }
+    return normalization;
+}
+
+}  // namespace
+
 /**
  * @brief This class stores pre-process information for exact input
  */
@@ -767,6 +1031,12 @@ class PreProcessData : public IPreProcessData {
      * BEWARE! Will be shared among copies!
      */
     std::shared_ptr<PreprocEngine> _preproc;
+    const void *_cacheOwner = nullptr;
+
+    void executeBatched(const BatchedBlob::Ptr &batchedBlob, Blob::Ptr &outBlob, const PreProcessInfo& info,
+                        bool serial, int batchSize);
+
+    void resizeWithoutGAPI(const Blob::Ptr &inBlob, const Blob::Ptr &outBlob, ResizeAlgorithm algorithm);
 
 public:
     void setRoiBlob(const Blob::Ptr &blob) override;
@@ -778,6 +1048,10 @@ public:
     void Release() noexcept override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
+
+    void setCacheOwner(const void *owner) override;
+
+    void getCacheStatistics(size_t &hits, size_t &misses) const override;
 };
 
 StatusCode CreatePreProcessData(IPreProcessData *& data, ResponseDesc */*resp*/) noexcept {
@@ -813,12 +1087,26 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
     }
 
+    if (!_preproc) {
+        _preproc.reset(new PreprocEngine(_cacheOwner));
+    }
+
+    if (auto batchedBlob = as<BatchedBlob>(_roiBlob)) {
+        executeBatched(batchedBlob, outBlob, info, serial, batchSize);
+        return;
+    }
+
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _roiBlob);
 
-    if (!_preproc) {
-        _preproc.reset(new PreprocEngine);
+    // with letterbox the image is resized to a centered part of the input and the rest is padded
+    Blob::Ptr dstBlob = outBlob;
+    if (info.getLetterbox() && algorithm != NO_RESIZE) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Letterbox");
+        dstBlob = make_letterbox_blob(_roiBlob, outBlob, info.getPadValue(), batchSize);
     }
-    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
+
+    const auto normalization = get_normalization(_roiBlob, outBlob, info);
+    if (_preproc->preprocessWithGAPI(_roiBlob, dstBlob, algorithm, fmt, serial, batchSize, normalization)) {
         return;
     }
 
@@ -827,34 +1115,97 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
                               "Use default pre-processing instead to process batches.";
     }
 
+    if (_roiBlob->getTensorDesc().getPrecision() != outBlob->getTensorDesc().getPrecision()) {
+        THROW_IE_EXCEPTION << "Precision conversion is unsupported in this mode. "
+                              "Use default pre-processing with bilinear resize instead.";
+    }
+
     if (fmt != ColorFormat::RAW) {
         THROW_IE_EXCEPTION << "Non-default (not ColorFormat::RAW) color formats are unsupported "
                               "in this mode. Use default pre-processing instead to process color "
                               "formats.";
     }
 
+    resizeWithoutGAPI(_roiBlob, dstBlob, algorithm);
+}
+
+void PreProcessData::executeBatched(const BatchedBlob::Ptr &batchedBlob, Blob::Ptr &outBlob,
+        const PreProcessInfo& info, bool serial, int batchSize) {
+    const auto& dstDims = outBlob->getTensorDesc().getDims();
+    if (dstDims.size() != 4) {
+        THROW_IE_EXCEPTION << "Batched pre-processing supports only 4D network's inputs";
+    }
+
+    // images beyond the current batch size are not processed
+    auto images = batchedBlob->size();
+    if (batchSize > 0) {
+        images = (std::min)(images, static_cast<size_t>(batchSize));
+    }
+    if (images > dstDims[0]) {
+        THROW_IE_EXCEPTION << "Number of images in batched blob " << images
+                           << " exceeds network's batch size " << dstDims[0];
+    }
+
+    const auto algorithm = info.getResizeAlgorithm();
+    const auto fmt = info.getColorFormat();
+
+    // every image is written directly to its batch item of the network input
+    std::vector<Blob::Ptr> inBlobs, outBlobs;
+    for (size_t i = 0; i < images; i++) {
+        inBlobs.push_back(batchedBlob->getBlob(i));
+
+        auto itemBlob = make_shared_blob(outBlob, ROI(i, 0, 0, dstDims[3], dstDims[2]));
+        if (info.getLetterbox() && algorithm != NO_RESIZE) {
+            itemBlob = make_letterbox_blob(inBlobs.back(), itemBlob, info.getPadValue(), 1);
+        }
+        outBlobs.push_back(itemBlob);
+    }
+
+    const auto normalization = get_normalization(batchedBlob->getBlob(0), outBlob, info);
+    if (_preproc->preprocessBatchWithGAPI(inBlobs, outBlobs, algorithm, fmt, serial, normalization)) {
+        return;
+    }
+
+    if (fmt != ColorFormat::RAW) {
+        THROW_IE_EXCEPTION << "Non-default (not ColorFormat::RAW) color formats are unsupported "
+                              "in this mode. Use default pre-processing instead to process color "
+                              "formats.";
+    }
+
+    if (!inBlobs.empty() && inBlobs[0]->getTensorDesc().getPrecision() != outBlob->getTensorDesc().getPrecision()) {
+        THROW_IE_EXCEPTION << "Precision conversion is unsupported in this mode. "
+                              "Use default pre-processing with bilinear resize instead.";
+    }
+
+    for (size_t i = 0; i < images; i++) {
+        resizeWithoutGAPI(inBlobs[i], outBlobs[i], algorithm);
+    }
+}
+
+void PreProcessData::resizeWithoutGAPI(const Blob::Ptr &inBlob, const Blob::Ptr &outBlob,
+        ResizeAlgorithm algorithm) {
     Blob::Ptr res_in, res_out;
-    if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp1 || _tmp1->size() != _roiBlob->size()) {
-            if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                _tmp1 = make_shared_blob<float>({Precision::FP32, _roiBlob->getTensorDesc().getDims(), Layout::NCHW});
+    if (inBlob->getTensorDesc().getLayout() == NHWC) {
+        if (!_tmp1 || _tmp1->getTensorDesc().getDims() != inBlob->getTensorDesc().getDims()) {
+            if (inBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+                _tmp1 = make_shared_blob<float>({Precision::FP32, inBlob->getTensorDesc().getDims(), Layout::NCHW});
             } else {
-                _tmp1 = make_shared_blob<uint8_t>({Precision::U8, _roiBlob->getTensorDesc().getDims(), Layout::NCHW});
+                _tmp1 = make_shared_blob<uint8_t>({Precision::U8, inBlob->getTensorDesc().getDims(), Layout::NCHW});
             }
             _tmp1->allocate();
         }
 
         {
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Reorder before");
-            blob_copy(_roiBlob, _tmp1);
+            blob_copy(inBlob, _tmp1);
         }
         res_in = _tmp1;
     } else {
-        res_in = _roiBlob;
+        res_in = inBlob;
     }
 
     if (outBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp2 || _tmp2->size() != outBlob->size()) {
+        if (!_tmp2 || _tmp2->getTensorDesc().getDims() != outBlob->getTensorDesc().getDims()) {
             if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
                 _tmp2 = make_shared_blob<float>({Precision::FP32, outBlob->getTensorDesc().getDims(), Layout::NCHW});
             } else {
@@ -878,6 +1229,20 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
     }
 }
 
+void PreProcessData::setCacheOwner(const void *owner) {
+    if (_preproc) {
+        THROW_IE_EXCEPTION << "Owner of the pre-processing cache must be set before the first execution";
+    }
+    _cacheOwner = owner;
+}
+
+void PreProcessData::getCacheStatistics(size_t &hits, size_t &misses) const {
+    hits = misses = 0;
+    if (_preproc) {
+        _preproc->getCacheStatistics(hits, misses);
+    }
+}
+
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // if G-API pre-processing is used, let it check that pre-processing is applicable
     if (PreprocEngine::useGAPI()) {
@@ -885,6 +1250,23 @@ void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
         return;
     }
 
+    if (auto batchedBlob = as<BatchedBlob>(src)) {
+        const auto &dst_dims = dst->getTensorDesc().getDims();
+        if (!dst_dims.empty() && batchedBlob->size() > dst_dims[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of images in batched blob "
+                               << batchedBlob->size() << " exceeds network's batch size " << dst_dims[0];
+        }
+        if (dst_dims.size() != 4) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Only 4D tensors are supported.";
+        }
+        // every image is checked against one batch item of the network input
+        const auto dstItem = make_shared_blob(dst, ROI(0, 0, 0, dst_dims[3], dst_dims[2]));
+        for (size_t i = 0; i < batchedBlob->size(); i++) {
+            isApplicable(batchedBlob->getBlob(i), dstItem);
+        }
+        return;
+    }
+
     if (!src->is<MemoryBlob>() || !dst->is<MemoryBlob>()) {
         THROW_IE_EXCEPTION << "Preprocessing is not applicable. Source and destination blobs must "
                               "be memory blobs";
@@ -904,6 +1286,11 @@ void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
         THROW_IE_EXCEPTION << "Preprocessing is not applicable. Wrong shape. Network expected 4D input tensor with "
                               "shape [" << dst_dims[0] << "," << dst_dims[1] <<",H,W] but provided tensor has "
                               "shape "  << details::dumpVec(src_dims) << ".";
+
+    // precision is converted only by G-API pre-processing
+    if (src->getTensorDesc().getPrecision() != dst->getTensorDesc().getPrecision())
+        THROW_IE_EXCEPTION << "Preprocessing is not applicable. Source and destination blobs have different "
+                              "precisions, conversion is supported only by G-API pre-processing.";
 }
 
 }  // namespace InferenceEngine
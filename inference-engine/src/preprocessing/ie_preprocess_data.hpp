@@ -49,13 +49,29 @@ public:
     /**
      * @brief Executes input pre-processing with a given pre-processing information.
      * @param outBlob pre-processed output blob to be used for inference.
-     * @param info pre-processing info that specifies resize algorithm and color format.
+     * @param info pre-processing info that specifies resize algorithm and color format. Mean values and
+     * scales are applied only if U8 ROI blob is converted into FP32/BF16 output blob.
      * @param serial disable OpenMP threading if the value set to true.
      * @param batchSize batch size for pre-processing.
      */
     virtual void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
 
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
+
+    /**
+     * @brief Sets an owner of the cache of compiled pre-processing graphs.
+     * @note Must be called before the first execution. Objects with the same owner share the cache,
+     * an object without an owner has its own cache.
+     * @param owner an object the cache belongs to, e.g. an executable network.
+     */
+    virtual void setCacheOwner(const void *owner) = 0;
+
+    /**
+     * @brief Gets statistics of the cache of compiled pre-processing graphs.
+     * @param hits number of calls which reused a compiled graph.
+     * @param misses number of calls which compiled or reshaped a graph.
+     */
+    virtual void getCacheStatistics(size_t &hits, size_t &misses) const = 0;
 };
 
 INFERENCE_PRERPOC_PLUGIN_API(StatusCode) CreatePreProcessData(IPreProcessData *& data, ResponseDesc *resp) noexcept;
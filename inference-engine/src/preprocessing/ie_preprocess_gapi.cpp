@@ -9,6 +9,10 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -77,6 +81,7 @@ inline int get_cv_depth(const TensorDesc &ie_desc) {
     switch (ie_desc.getPrecision()) {
     case Precision::U8:   return CV_8U;
     case Precision::FP32: return CV_32F;
+    case Precision::BF16: return CV_16U;
     default: THROW_IE_EXCEPTION << "Unsupported data type";
     }
 }
@@ -543,7 +548,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
                             ColorFormat output_color_format,
-                            int precision) {
+                            int precision,
+                            int out_precision,
+                            const std::vector<float> &normalization) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -574,6 +581,15 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                                             || input_color_format == output_color_format
                                             || drop_channel
                                             || specific_yuv420_input_handling));
+    // U8 image is converted into a floating point network input only by the specific case, which
+    // resizes, normalizes and converts planes at once
+    if (out_precision != precision) {
+        if (!specific_case_of_preproc || out_layout != NCHW || drop_channel) {
+            THROW_IE_EXCEPTION << "[G-API] precision conversion is supported only for bilinear resize of "
+                               << "interleaved 8U 3-channel or NV12/I420 images into planar FP32/BF16";
+        }
+    }
+
     if (specific_case_of_preproc) {
         const auto input_sz = cv::gapi::own::Size(in_desc.d.W, in_desc.d.H);
         const auto scale_sz = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
@@ -588,6 +604,30 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             color_converted_input = inputs;
         }
 
+        // floating point planes are resized, reordered and normalized by a single kernel,
+        // normalization holds means followed by scales, identity if empty
+        if (out_precision != precision) {
+            const bool reverse = specific_yuv420_input_handling && output_color_format == ColorFormat::BGR;
+            const auto channels = static_cast<std::size_t>(out_desc.d.C);
+            std::vector<float> mean(channels, 0.f), scale(channels, 1.f);
+            if (!normalization.empty()) {
+                mean.assign(normalization.begin(), normalization.begin() + channels);
+                scale.assign(normalization.begin() + channels, normalization.end());
+            }
+            auto planes = to_vec(gapi::ScaleNormalizePlanes3::on(
+                    color_converted_input[0], out_precision, input_sz, scale_sz, cv::INTER_LINEAR, reverse,
+                    mean, scale));
+            return cv::GComputation(inputs, planes);
+        }
+
+        // interleaved output is resized, reordered and merged by a single kernel
+        if (out_layout == NHWC && !drop_channel) {
+            const bool reverse = specific_yuv420_input_handling && output_color_format == ColorFormat::BGR;
+            std::vector<cv::GMat> outputs = { gapi::ScaleInterleaved3::on(
+                    color_converted_input[0], input_sz, scale_sz, cv::INTER_LINEAR, reverse) };
+            return cv::GComputation(inputs, outputs);
+        }
+
         auto planes = drop_channel ?
                 to_vec(gapi::ScalePlanes4:: on(
                         color_converted_input[0], precision, input_sz, scale_sz, cv::INTER_LINEAR))
@@ -631,6 +671,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             switch (ar) {
             case RESIZE_AREA:     return cv::INTER_AREA;
             case RESIZE_BILINEAR: return cv::INTER_LINEAR;
+            case RESIZE_NEAREST:  return cv::INTER_NEAREST;
             default: THROW_IE_EXCEPTION << "Unsupported resize operation";
             }
         } (algorithm);
@@ -655,31 +696,27 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
-
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
+    // 6. normalization has changed (kernel parameters)
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::vector<float> last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    std::vector<float> new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -695,7 +732,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -728,6 +765,112 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     return Update::NOTHING;
 }
 
+class PreprocEngine::Cache {
+public:
+    using Entry = std::unique_ptr<Compiled>;
+
+    // Returns the cache shared by all engines of the owner, an engine without an owner gets its own cache
+    static std::shared_ptr<Cache> get(const void* owner) {
+        if (owner == nullptr) {
+            return std::make_shared<Cache>();
+        }
+        static std::mutex mutex;
+        static std::map<const void*, std::weak_ptr<Cache>> caches;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = caches.begin(); it != caches.end();) {
+            it = it->second.expired() ? caches.erase(it) : std::next(it);
+        }
+        auto& weak = caches[owner];
+        auto cache = weak.lock();
+        if (!cache) {
+            cache = std::make_shared<Cache>();
+            weak = cache;
+        }
+        return cache;
+    }
+
+    // Takes a graph compiled for the call split on the given number of slices out of the cache.
+    // On a miss returns either a graph of the least recently used call to be reshaped (only if the cache
+    // is full, otherwise graphs compiled for other input sizes are kept) or an empty entry to be
+    // compiled from scratch.
+    Entry acquire(const CallDesc &call, std::size_t slices, Update &update) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto found = find(call, slices);
+        if (found != _calls.end() && !found->pool.empty()) {
+            auto entry = std::move(found->pool.back());
+            found->pool.pop_back();
+            _calls.splice(_calls.begin(), _calls, found);
+            _hits++;
+            update = Update::NOTHING;
+            return entry;
+        }
+
+        _misses++;
+        if (found == _calls.end() && _calls.size() >= _capacity) {
+            auto& victim = _calls.back();
+            if (!victim.pool.empty() && victim.slices == slices && Update::RESHAPE == needUpdate(victim.desc, call)) {
+                auto entry = std::move(victim.pool.back());
+                _calls.pop_back();
+                entry->desc = call;
+                update = Update::RESHAPE;
+                return entry;
+            }
+        }
+
+        update = Update::REBUILD;
+        return Entry(new Compiled{call, std::vector<cv::GCompiled>(slices)});
+    }
+
+    // Returns a graph to the cache, its call becomes the most recently used one. Concurrent calls
+    // with the same description compile a graph each, so a call keeps a pool of graphs, which never
+    // exceeds the number of its concurrent users.
+    void release(Entry entry) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto found = find(entry->desc, entry->slices.size());
+        if (found == _calls.end()) {
+            _calls.push_front(Call{entry->desc, entry->slices.size(), {}});
+        } else {
+            _calls.splice(_calls.begin(), _calls, found);
+        }
+        _calls.front().pool.push_back(std::move(entry));
+        while (_calls.size() > _capacity) {
+            _calls.pop_back();
+        }
+    }
+
+    void statistics(std::size_t& hits, std::size_t& misses) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        hits = _hits;
+        misses = _misses;
+    }
+
+private:
+    struct Call {
+        CallDesc desc;
+        std::size_t slices;
+        std::vector<Entry> pool;
+    };
+
+    std::list<Call>::iterator find(const CallDesc &call, std::size_t slices) {
+        return std::find_if(_calls.begin(), _calls.end(), [&](const Call& cached) {
+            return cached.desc == call && cached.slices == slices;
+        });
+    }
+
+    // Enough for video pipelines multiplexing streams of several resolutions
+    std::size_t _capacity = 16;
+    std::list<Call> _calls;
+    std::size_t _hits = 0;
+    std::size_t _misses = 0;
+    std::mutex _mutex;
+};
+
+PreprocEngine::PreprocEngine(const void* cacheOwner) : _cache(Cache::get(cacheOwner)) {}
+
+void PreprocEngine::getCacheStatistics(std::size_t& hits, std::size_t& misses) const {
+    _cache->statistics(hits, misses);
+}
+
 bool PreprocEngine::useGAPI() {
     static const bool NO_GAPI = [](const char *str) -> bool {
         std::string var(str ? str : "");
@@ -740,6 +883,19 @@ bool PreprocEngine::useGAPI() {
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
+    // every image of a batched blob is pre-processed into its own batch item
+    if (auto batchedBlob = as<BatchedBlob>(src)) {
+        const auto &dst_dims = dst->getTensorDesc().getDims();
+        if (!dst_dims.empty() && batchedBlob->size() > dst_dims[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of images in batched blob "
+                               << batchedBlob->size() << " exceeds network's batch size " << dst_dims[0];
+        }
+        for (std::size_t i = 0; i < batchedBlob->size(); ++i) {
+            checkApplicabilityGAPI(batchedBlob->getBlob(i), dst);
+        }
+        return;
+    }
+
     // src is either a memory blob, an NV12, or an I420 blob
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
     if (!src->is<MemoryBlob>() && !yuv420_blob) {
@@ -771,6 +927,15 @@ void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr
     if (has_zeros(dst_dims)) {
         THROW_IE_EXCEPTION << "Invalid network's input dimensions: " << details::dumpVec(dst_dims);
     }
+
+    // U8 image may be converted only into floating point network input
+    const auto src_precision = src->getTensorDesc().getPrecision();
+    const auto dst_precision = dst->getTensorDesc().getPrecision();
+    if (src_precision != dst_precision &&
+        !(src_precision == Precision::U8 && (dst_precision == Precision::FP32 || dst_precision == Precision::BF16))) {
+        THROW_IE_EXCEPTION << "Preprocessing is not applicable. Conversion of " << src_precision
+                           << " input blob into " << dst_precision << " network input is not supported.";
+    }
 }
 
 int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
@@ -794,11 +959,13 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
 }
 
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+    std::vector<cv::GCompiled>& compiledSlices,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
 
     const int thread_num =
+        compiledSlices.size() == 1 ? 1 :  // the whole image is processed by the calling thread
 #if IE_THREAD == IE_THREAD_OMP
         omp_serial ? 1 :    // disable threading for OpenMP if was asked for
 #endif
@@ -816,7 +983,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
+        auto& compiled = compiledSlices[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
@@ -859,6 +1026,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             }
         }
 
+        if (!compiled) return;  // no rows for current thread
+
         for (int i = 0; i < batch_size; ++i) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
@@ -877,7 +1046,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, std::size_t slices, const std::vector<float> &normalization) {
 
     validateBlob(inBlob);
 
@@ -911,6 +1080,13 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
+    // normalization is done only together with conversion to floating point network input
+    const bool convert = in_desc_ie.getPrecision() != out_desc_ie.getPrecision();
+    if (convert && !normalization.empty() && normalization.size() != 2 * static_cast<std::size_t>(out_desc.d.C)) {
+        THROW_IE_EXCEPTION << "[G-API] internal error: normalization is expected for "
+                           << out_desc.d.C << " channels";
+    }
+
     CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
                                             in_layout,
                                             in_desc_ie.getDims(),
@@ -919,53 +1095,47 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
-    const Update update = needUpdate(thisCall);
+                                  algorithm,
+                                  convert ? normalization : std::vector<float>{} };
+    Update update = Update::NOTHING;
+    auto compiled = _cache->acquire(thisCall, slices, update);
 
     Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
-            auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(custom_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt,
-                           get_cv_depth(in_desc_ie)));
-        }
+    if (Update::REBUILD == update) {
+        //  rebuild the graph
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
+        auto custom_desc = getGDesc(in_desc, inBlob);
+        _lastComputation = cv::util::make_optional(
+            buildGraph(custom_desc,
+                       out_desc,
+                       in_layout,
+                       out_layout,
+                       algorithm,
+                       in_fmt,
+                       out_fmt,
+                       get_cv_depth(in_desc_ie),
+                       get_cv_depth(out_desc_ie),
+                       std::get<3>(thisCall)));
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    executeGraph(_lastComputation, compiled->slices, batched_input_plane_mats, batched_output_plane_mats,
+        batch_size, omp_serial, update);
+
+    // the graph is dropped if execution has thrown, so the cache keeps only consistent graphs
+    _cache->release(std::move(compiled));
 
     return true;
 }
 
-bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
-    if (!useGAPI()) {
-        return false;
-    }
-
+bool PreprocEngine::dispatchBlob(Blob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size, std::size_t slices,
+        const std::vector<float> &normalization) {
     const auto out_fmt = ColorFormat::BGR;  // FIXME: get expected color format from network
 
-    // output is always a memory blob
-    auto outMemoryBlob = as<MemoryBlob>(outBlob);
-    if (!outMemoryBlob) {
-        THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
-    }
-
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
@@ -976,8 +1146,8 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected NV12Blob";
         }
-        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inNV12Blob, outBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            batch_size, slices, normalization);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -985,8 +1155,8 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected I420Blob";
         }
-        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inI420Blob, outBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            batch_size, slices, normalization);
     }
 
     default:
@@ -995,8 +1165,71 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected MemoryBlob";
         }
-        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inMemoryBlob, outBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            batch_size, slices, normalization);
+    }
+}
+
+bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const std::vector<float> &normalization) {
+    if (!useGAPI()) {
+        return false;
+    }
+
+    // bicubic interpolation needs 4 input rows per output row while Fluid resize kernels
+    // get at most 2, so it is done by the default pre-processing
+    if (algorithm == RESIZE_BICUBIC) {
+        return false;
     }
+
+    // output is always a memory blob
+    auto outMemoryBlob = as<MemoryBlob>(outBlob);
+    if (!outMemoryBlob) {
+        THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
+    }
+
+    // rows of the output are split between all threads
+    return dispatchBlob(inBlob, outMemoryBlob, algorithm, in_fmt, omp_serial, batch_size,
+        parallel_get_max_threads(), normalization);
+}
+
+bool PreprocEngine::preprocessBatchWithGAPI(std::vector<Blob::Ptr> &inBlobs, std::vector<Blob::Ptr> &outBlobs,
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial,
+        const std::vector<float> &normalization) {
+    if (!useGAPI() || algorithm == RESIZE_BICUBIC) {
+        return false;
+    }
+
+    if (inBlobs.size() != outBlobs.size()) {
+        THROW_IE_EXCEPTION  << "[G-API] internal error: number of images != number of batch items: "
+                            << inBlobs.size() << " != " << outBlobs.size();
+    }
+
+    std::vector<MemoryBlob::Ptr> outMemoryBlobs;
+    for (const auto& outBlob : outBlobs) {
+        auto outMemoryBlob = as<MemoryBlob>(outBlob);
+        if (!outMemoryBlob) {
+            THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
+        }
+        outMemoryBlobs.push_back(outMemoryBlob);
+    }
+
+    // images have different sizes, so every image is processed as a whole by one thread with
+    // its own graph rather than split by rows between threads like a batch of equal images
+    auto process = [&](std::size_t i) {
+        dispatchBlob(inBlobs[i], outMemoryBlobs[i], algorithm, in_fmt, omp_serial, 1, 1, normalization);
+    };
+
+#if IE_THREAD == IE_THREAD_OMP
+    if (omp_serial) {
+        for (std::size_t i = 0; i < inBlobs.size(); ++i) {
+            process(i);
+        }
+        return true;
+    }
+#endif
+    parallel_for(inBlobs.size(), process);
+    return true;
 }
 }  // namespace InferenceEngine
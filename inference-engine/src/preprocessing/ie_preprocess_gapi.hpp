@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -23,11 +24,19 @@ namespace InferenceEngine {
 
 class PreprocEngine {
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    // the last element is normalization applied on conversion to floating point: means followed by scales
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, std::vector<float>>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // Graph compiled for a particular call, one object per thread slice
+    struct Compiled {
+        CallDesc desc;
+        std::vector<cv::GCompiled> slices;
+    };
+
+    // LRU cache of compiled graphs shared by all engines of one owner
+    class Cache;
+    std::shared_ptr<Cache> _cache;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -35,9 +44,10 @@ class PreprocEngine {
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      std::vector<cv::GCompiled>& compiledSlices,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
@@ -47,15 +57,51 @@ class PreprocEngine {
     template<typename BlobTypePtr>
     bool preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, std::size_t slices, const std::vector<float> &normalization);
+
+    bool dispatchBlob(Blob::Ptr &inBlob, MemoryBlob::Ptr &outBlob, ResizeAlgorithm algorithm,
+        ColorFormat in_fmt, bool omp_serial, int batch_size, std::size_t slices,
+        const std::vector<float> &normalization);
 
 public:
-    PreprocEngine();
+    /**
+     * @param cacheOwner  Engines with the same owner share compiled graphs, e.g. pre-processing of all inputs
+     *                    of infer requests of one executable network. An engine without an owner has its own cache.
+     */
+    explicit PreprocEngine(const void* cacheOwner = nullptr);
+
     static bool useGAPI();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
+
+    /**
+     * @brief Pre-processes an image into the network input
+     * @param normalization  Means followed by scales per channel, the output is (value - mean) * scale.
+     *                       Applied only when a U8 image is converted into a FP32/BF16 network input
+     * @return false if G-API pre-processing is not applicable
+     */
     bool preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1,
+        const std::vector<float> &normalization = {});
+
+    /**
+     * @brief Pre-processes a list of images of different sizes into batch items, images are
+     *        processed in parallel
+     * @param inBlobs   Images, memory, NV12 or I420 blobs with batch size 1
+     * @param outBlobs  Batch items of the network input, one per image
+     * @param normalization  Same as for preprocessWithGAPI
+     * @return false if G-API pre-processing is not applicable
+     */
+    bool preprocessBatchWithGAPI(std::vector<Blob::Ptr> &inBlobs, std::vector<Blob::Ptr> &outBlobs,
+        const ResizeAlgorithm &algorithm, ColorFormat in_fmt, bool omp_serial,
+        const std::vector<float> &normalization = {});
+
+    /**
+     * @brief Gets statistics of the compiled graphs cache
+     * @param hits    Number of calls which reused a compiled graph
+     * @param misses  Number of calls which compiled or reshaped a graph
+     */
+    void getCacheStatistics(std::size_t& hits, std::size_t& misses) const;
 };
 
 }  // namespace InferenceEngine
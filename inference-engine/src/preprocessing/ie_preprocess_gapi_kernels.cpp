@@ -34,6 +34,7 @@
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include <cstring>
 
 #if defined(__GNUC__) && (__GNUC__ <= 5)
 #include <cmath>
@@ -714,10 +715,24 @@ G_TYPED_KERNEL(ScalePlaneArea32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie
     }
 };
 
+G_TYPED_KERNEL(ScalePlaneNearest8u, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_nearest_8u") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert(in.depth == CV_8U && in.chan == 1);
+        return in.withSize(sz);
+    }
+};
+
+G_TYPED_KERNEL(ScalePlaneNearest32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_nearest_32f") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        return in.withSize(sz);
+    }
+};
+
 GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     static cv::GMat expand(cv::GMat in, int type, const Size& szIn, const Size& szOut, int interp) {
         GAPI_DbgAssert(CV_8UC1 == type || CV_32FC1 == type);
-        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp || cv::INTER_NEAREST == interp);
 
         if (cv::INTER_AREA == interp) {
             bool upscale = szIn.width < szOut.width || szIn.height < szOut.height;
@@ -744,6 +759,15 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
             }
         }
 
+        if (cv::INTER_NEAREST == interp) {
+            if (CV_8UC1 == type) {
+                return ScalePlaneNearest8u::on(in, szOut, interp);
+            }
+            if (CV_32FC1 == type) {
+                return ScalePlaneNearest32f::on(in, szOut, interp);
+            }
+        }
+
         GAPI_Assert(!"unsupported parameters");
         return {};
     }
@@ -794,12 +818,14 @@ template<typename T, typename Mapper, int chanNum = 1>
 static void initScratchLinear(const cv::GMatDesc& in,
                               const         Size& outSz,
                          cv::gapi::fluid::Buffer& scratch,
-                                             int  lpi) {
+                                             int  lpi,
+                                             int  extraSize = 0) {
     using alpha_type = typename Mapper::alpha_type;
     static const auto unity = Mapper::unity;
 
     auto inSz = in.size;
-    auto sbufsize = linearScratchDesc<T, Mapper, chanNum>::bufSize(inSz.width, inSz.height, outSz.width, outSz.height, lpi);
+    auto sbufsize = linearScratchDesc<T, Mapper, chanNum>::bufSize(inSz.width, inSz.height, outSz.width, outSz.height, lpi)
+                  + extraSize;
 
     Size scratch_size{sbufsize, 1};
 
@@ -998,18 +1024,16 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
     }
 }
 
+// Resizes lpi rows of interleaved input into planar rows given by dst
 template<typename T, class Mapper, int numChan>
 static void calcRowLinearC(const cv::gapi::fluid::View  & in,
-                           std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, numChan>& out,
+                           std::array<std::array<T*, 4>, numChan>& dst,
+                           Size outSz, int outY, int lpi, int length,
                                   cv::gapi::fluid::Buffer& scratch) {
     using alpha_type = typename Mapper::alpha_type;
 
     auto  inSz =  in.meta().size;
-    auto outSz = out[0].get().meta().size;
-
     auto inY  = in.y();
-    auto outY = out[0].get().y();
-    auto lpi  = out[0].get().lpi();
 
     GAPI_DbgAssert(outY + lpi <= outSz.height);
     GAPI_DbgAssert(lpi <= 4);
@@ -1026,16 +1050,12 @@ static void calcRowLinearC(const cv::gapi::fluid::View  & in,
     const auto *beta = beta0 + outY;
     const T *src0[4];
     const T *src1[4];
-    std::array<std::array<T*, 4>, numChan> dst;
 
     for (int l = 0; l < lpi; l++) {
         auto index0 = mapsy[outY + l] - inY;
         auto index1 = mapsy[outSz.height + outY + l] - inY;
         src0[l] = in.InLine<const T>(index0);
         src1[l] = in.InLine<const T>(index1);
-        for (int c=0; c < numChan; c++) {
-            dst[c][l] = out[c].get().template OutLine<T>(l);
-        }
     }
 
 #ifdef HAVE_AVX512
@@ -1095,8 +1115,6 @@ static void calcRowLinearC(const cv::gapi::fluid::View  & in,
     }
 #endif  // HAVE_SSE
 
-    auto length = out[0].get().length();
-
     for (int l = 0; l < lpi; l++) {
         constexpr static const auto unity = Mapper::unity;
 
@@ -1120,6 +1138,24 @@ static void calcRowLinearC(const cv::gapi::fluid::View  & in,
     }
 }
 
+template<typename T, class Mapper, int numChan>
+static void calcRowLinearC(const cv::gapi::fluid::View  & in,
+                           std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, numChan>& out,
+                                  cv::gapi::fluid::Buffer& scratch) {
+    auto outSz = out[0].get().meta().size;
+    auto outY  = out[0].get().y();
+    auto lpi   = out[0].get().lpi();
+
+    std::array<std::array<T*, 4>, numChan> dst;
+    for (int l = 0; l < lpi; l++) {
+        for (int c = 0; c < numChan; c++) {
+            dst[c][l] = out[c].get().template OutLine<T>(l);
+        }
+    }
+
+    calcRowLinearC<T, Mapper, numChan>(in, dst, outSz, outY, lpi, out[0].get().length(), scratch);
+}
+
 
 //------------------------------------------------------------------------------
 
@@ -1904,6 +1940,180 @@ GAPI_FLUID_KERNEL(FScalePlanes4, ScalePlanes4, true) {
     }
 };
 
+// Resize of interleaved image with interleaved output: planar rows are kept in the scratch
+// buffer and merged right after resize, so no intermediate planar image is produced
+GAPI_FLUID_KERNEL(FScaleInterleaved3, ScaleInterleaved3, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+    static constexpr int numChan = 3;
+
+    static int planesOffset(const Size& inSz, const Size& outSz) {
+        return linearScratchDesc<uchar, linear::Mapper, numChan>::bufSize(inSz.width, inSz.height,
+                                                                          outSz.width, outSz.height, LPI);
+    }
+
+    static void initScratch(const cv::GMatDesc& in, Size,
+                            Size outSz, int /*interp*/, bool /*reverse*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchLinear<uchar, linear::Mapper, numChan>(in, outSz, scratch, LPI, numChan * LPI * outSz.width);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size, Size/*sz*/, int /*interp*/, bool reverse,
+                    cv::gapi::fluid::Buffer& out,
+                    cv::gapi::fluid::Buffer& scratch) {
+        const auto inSz  = in.meta().size;
+        const auto outSz = out.meta().size;
+        const int lpi    = out.lpi();
+        const int length = out.length();
+
+        auto* planes = scratch.OutLineB() + planesOffset(inSz, outSz);
+        std::array<std::array<uint8_t*, 4>, numChan> rows;
+        for (int c = 0; c < numChan; c++) {
+            for (int l = 0; l < LPI; l++) {
+                rows[c][l] = planes + (c * LPI + l) * outSz.width;
+            }
+        }
+
+        calcRowLinearC<uint8_t, linear::Mapper, numChan>(in, rows, outSz, out.y(), lpi, length, scratch);
+
+        const int first = reverse ? 2 : 0;
+        const int last  = reverse ? 0 : 2;
+        for (int l = 0; l < lpi; l++) {
+            mergeRow<uint8_t, numChan>({rows[first][l], rows[1][l], rows[last][l]}, out.OutLineB(l), length);
+        }
+    }
+};
+
+static void normalizeRow(const uint8_t in[], float out[], int length, float mean, float scale) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::normalizeRow_8U32F(in, out, length, mean, scale);
+        return;
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow_8U32F(in, out, length, mean, scale);
+        return;
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow_8U32F(in, out, length, mean, scale);
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    neon::normalizeRow_8U32F(in, out, length, mean, scale);
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        out[x] = (static_cast<float>(in[x]) - mean) * scale;
+    }
+}
+
+// bf16 is the upper half of fp32 rounded to nearest even, values are finite here
+static void normalizeRow(const uint8_t in[], uint16_t out[], int length, float mean, float scale) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::normalizeRow_8UBF16(in, out, length, mean, scale);
+        return;
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow_8UBF16(in, out, length, mean, scale);
+        return;
+    }
+    #endif  // HAVE_AVX2
+
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow_8UBF16(in, out, length, mean, scale);
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    neon::normalizeRow_8UBF16(in, out, length, mean, scale);
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        const float value = (static_cast<float>(in[x]) - mean) * scale;
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        out[x] = static_cast<uint16_t>((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+    }
+}
+
+// Resize of interleaved image into normalized planes of floating point type: 8U planar rows are kept
+// in the scratch buffer and converted right after resize, so no intermediate 8U image is produced
+GAPI_FLUID_KERNEL(FScaleNormalizePlanes3, ScaleNormalizePlanes3, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+    static constexpr int numChan = 3;
+
+    static int planesOffset(const Size& inSz, const Size& outSz) {
+        return linearScratchDesc<uchar, linear::Mapper, numChan>::bufSize(inSz.width, inSz.height,
+                                                                          outSz.width, outSz.height, LPI);
+    }
+
+    static void initScratch(const cv::GMatDesc& in, int, Size,
+                            Size outSz, int /*interp*/, bool /*reverse*/,
+                            const std::vector<float>&, const std::vector<float>&,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchLinear<uchar, linear::Mapper, numChan>(in, outSz, scratch, LPI, numChan * LPI * outSz.width);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, int depth, Size, Size/*sz*/, int /*interp*/, bool reverse,
+                    const std::vector<float>& mean, const std::vector<float>& scale,
+                    cv::gapi::fluid::Buffer& out1,
+                    cv::gapi::fluid::Buffer& out2,
+                    cv::gapi::fluid::Buffer& out3,
+                    cv::gapi::fluid::Buffer& scratch) {
+        std::array<std::reference_wrapper<cv::gapi::fluid::Buffer>, numChan> out = {out1, out2, out3};
+        const auto inSz  = in.meta().size;
+        const auto outSz = out1.meta().size;
+        const int lpi    = out1.lpi();
+        const int length = out1.length();
+
+        auto* planes = scratch.OutLineB() + planesOffset(inSz, outSz);
+        std::array<std::array<uint8_t*, 4>, numChan> rows;
+        for (int c = 0; c < numChan; c++) {
+            for (int l = 0; l < LPI; l++) {
+                rows[c][l] = planes + (c * LPI + l) * outSz.width;
+            }
+        }
+
+        calcRowLinearC<uint8_t, linear::Mapper, numChan>(in, rows, outSz, out1.y(), lpi, length, scratch);
+
+        for (int c = 0; c < numChan; c++) {
+            const int plane = reverse ? numChan - 1 - c : c;
+            for (int l = 0; l < lpi; l++) {
+                if (depth == CV_32F) {
+                    normalizeRow(rows[plane][l], out[c].get().OutLine<float>(l), length, mean[c], scale[c]);
+                } else {
+                    normalizeRow(rows[plane][l], out[c].get().OutLine<uint16_t>(l), length, mean[c], scale[c]);
+                }
+            }
+        }
+    }
+};
+
 GAPI_FLUID_KERNEL(FUpscalePlaneArea8u, UpscalePlaneArea8u, true) {
     static const int Window = 1;
     static const int LPI = 4;
@@ -2035,6 +2245,112 @@ GAPI_FLUID_KERNEL(FScalePlaneArea8u, ScalePlaneArea8u, true) {
     }
 };
 
+//----------------------------------------------------------------------
+
+static void initScratchNearest(const cv::GMatDesc& in, const Size& outSz,
+                               cv::gapi::fluid::Buffer& scratch) {
+    const Size& inSz = in.size;
+
+    // input column and input row for every output column and row
+    size_t scratch_bytes = (outSz.width + outSz.height) * sizeof(int);
+    Size scratch_size{static_cast<int>(scratch_bytes), 1};
+
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = scratch_size;
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+
+    auto *mapsx = scratch.OutLine<int>();
+    auto *mapsy = mapsx + outSz.width;
+
+    const double xratio = static_cast<double>(inSz.width) / outSz.width;
+    for (int x = 0; x < outSz.width; x++) {
+        mapsx[x] = (std::min)(static_cast<int>(x * xratio), inSz.width - 1);
+    }
+
+    // rows are rounded the same way as Fluid computes the window of input rows for downscale,
+    // so the nearest row is always available in the view
+    const double yratio = static_cast<double>(inSz.height) / outSz.height;
+    const double eps = yratio >= 1.0 ? 1e-3 : 0.0;
+    for (int y = 0; y < outSz.height; y++) {
+        mapsy[y] = (std::min)(static_cast<int>(y * yratio + eps), inSz.height - 1);
+    }
+}
+
+template<typename T>
+static void calcRowNearest(const cv::gapi::fluid::View  & in,
+                                 cv::gapi::fluid::Buffer& out,
+                                 cv::gapi::fluid::Buffer& scratch) {
+    auto  inSz =  in.meta().size;
+    auto outSz = out.meta().size;
+
+    const auto *mapsx = scratch.OutLine<int>();
+    const auto *mapsy = mapsx + outSz.width;
+
+    int inY = in.y();
+    int outY = out.y();
+    int lpi = out.lpi();
+    int length = out.length();
+    GAPI_DbgAssert(outY + lpi <= outSz.height);
+
+    for (int l = 0; l < lpi; l++) {
+        const T *src = in.InLine<T>(mapsy[outY + l] - inY);
+        T *dst = out.OutLine<T>(l);
+
+        if (inSz.width == outSz.width) {
+            std::copy_n(src, length, dst);
+            continue;
+        }
+
+        for (int x = 0; x < length; x++) {
+            dst[x] = src[mapsx[x]];
+        }
+    }
+}
+
+GAPI_FLUID_KERNEL(FScalePlaneNearest8u, ScalePlaneNearest8u, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchNearest(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        calcRowNearest<uint8_t>(in, out, scratch);
+    }
+};
+
+GAPI_FLUID_KERNEL(FScalePlaneNearest32f, ScalePlaneNearest32f, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchNearest(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        calcRowNearest<float>(in, out, scratch);
+    }
+};
+
 static const int ITUR_BT_601_CY = 1220542;
 static const int ITUR_BT_601_CUB = 2116026;
 static const int ITUR_BT_601_CUG = -409993;
@@ -2240,6 +2556,8 @@ cv::gapi::GKernelPackage preprocKernels() {
         < FChanToPlane
         , FScalePlanes
         , FScalePlanes4
+        , FScaleInterleaved3
+        , FScaleNormalizePlanes3
         , FScalePlane
         , FScalePlane32f
         , FScalePlane8u
@@ -2247,6 +2565,8 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FUpscalePlaneArea32f
         , FScalePlaneArea8u
         , FScalePlaneArea32f
+        , FScalePlaneNearest8u
+        , FScalePlaneNearest32f
         , FMerge2
         , FMerge3
         , FMerge4
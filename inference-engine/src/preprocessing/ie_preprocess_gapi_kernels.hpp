@@ -9,6 +9,7 @@
 # endif
 
 #include <tuple>
+#include <vector>
 
 #include <opencv2/gapi/opencv_includes.hpp>
 #include <opencv2/gapi.hpp>
@@ -65,6 +66,37 @@ namespace gapi {
         }
     };
 
+    G_TYPED_KERNEL(ScaleInterleaved3, <cv::GMat(cv::GMat, Size, Size, int, bool)>, "com.intel.ie.scale_interleaved3") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &szIn, const Size &szOut, int interp,
+                                    bool /*reverse*/) {
+            // This kernel supports only RGB 8U inputs
+            GAPI_Assert(in.depth == CV_8U);
+            GAPI_Assert(in.chan == 3);
+            // cv::INTER_LINEAR is the only supported interpolation
+            GAPI_Assert(interp == cv::INTER_LINEAR);
+            return in.withSize(szOut);
+        }
+    };
+
+    // depth is CV_32F for FP32 and CV_16U for BF16 output planes, every plane is normalized as (value - mean) * scale
+    G_TYPED_KERNEL_M(ScaleNormalizePlanes3, <GMat3(cv::GMat, int, Size, Size, int, bool, std::vector<float>, std::vector<float>)>,
+                     "com.intel.ie.scale_normalize_planes3") {
+        static std::tuple<cv::GMatDesc, cv::GMatDesc, cv::GMatDesc> outMeta(const cv::GMatDesc &in, int depth, const Size &,
+                                                                            const Size &szOut, int interp, bool /*reverse*/,
+                                                                            const std::vector<float> &mean,
+                                                                            const std::vector<float> &scale) {
+            // This kernel supports only RGB 8U inputs
+            GAPI_Assert(in.depth == CV_8U);
+            GAPI_Assert(in.chan == 3);
+            // cv::INTER_LINEAR is the only supported interpolation
+            GAPI_Assert(interp == cv::INTER_LINEAR);
+            GAPI_Assert(depth == CV_32F || depth == CV_16U);
+            GAPI_Assert(mean.size() == 3 && scale.size() == 3);
+            cv::GMatDesc out_desc = in.withType(depth, 1).withSize(szOut);
+            return std::make_tuple(out_desc, out_desc, out_desc);
+        }
+    };
+
     G_TYPED_KERNEL(Merge2, <cv::GMat(cv::GMat, cv::GMat)>, "com.intel.ie.merge2") {
         static cv::GMatDesc outMeta(const cv::GMatDesc &in, const cv::GMatDesc &) {
             // FIXME: check a/b are equal!
@@ -2,6 +2,7 @@
 #define IE_PREPROCESS_GAPI_KERNELS_SIMD_IMPL_H
 
 #include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "ie_preprocess_gapi_kernels_impl.hpp"
@@ -783,6 +784,82 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+//------------------------------------------------------------------------------
+
+#if MANUAL_SIMD
+static inline v_float32 normalize_impl(const v_uint32& in, const v_float32& mean, const v_float32& scale) {
+    return (v_cvt_f32(v_reinterpret_as_s32(in)) - mean) * scale;
+}
+
+// bf16 is the upper half of fp32 rounded to nearest even, values are finite here
+static inline v_uint32 bf16_impl(const v_float32& value) {
+    const v_uint32 bits = v_reinterpret_as_u32(value);
+    return (bits + vx_setall_u32(0x7FFFu) + ((bits >> 16) & vx_setall_u32(1u))) >> 16;
+}
+
+static inline void normalizeLanes_8U32F(const uint8_t in[], float out[], int l,
+                                        const v_float32& mean, const v_float32& scale) {
+    vx_store(&out[l], normalize_impl(vx_load_expand_q(&in[l]), mean, scale));
+}
+
+static inline void normalizeLanes_8UBF16(const uint8_t in[], uint16_t out[], int l,
+                                         const v_float32& mean, const v_float32& scale) {
+    v_uint32 lo, hi;
+    v_expand(vx_load_expand(&in[l]), lo, hi);
+    vx_store(&out[l], v_pack(bf16_impl(normalize_impl(lo, mean, scale)),
+                             bf16_impl(normalize_impl(hi, mean, scale))));
+}
+#endif
+
+inline void normalizeRow_8U32F_impl(const uint8_t in[], float out[], int length, float mean, float scale) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean  = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        normalizeLanes_8U32F(in, out, l, vmean, vscale);
+    }
+
+    if (l < length && length >= nlanes) {
+        normalizeLanes_8U32F(in, out, length - nlanes, vmean, vscale);
+        l = length;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (static_cast<float>(in[l]) - mean) * scale;
+    }
+}
+
+inline void normalizeRow_8UBF16_impl(const uint8_t in[], uint16_t out[], int length, float mean, float scale) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_uint16::nlanes;
+    const v_float32 vmean  = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        normalizeLanes_8UBF16(in, out, l, vmean, vscale);
+    }
+
+    if (l < length && length >= nlanes) {
+        normalizeLanes_8UBF16(in, out, length - nlanes, vmean, vscale);
+        l = length;
+    }
+#endif
+
+    for (; l < length; l++) {
+        const float value = (static_cast<float>(in[l]) - mean) * scale;
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        out[l] = static_cast<uint16_t>((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+    }
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
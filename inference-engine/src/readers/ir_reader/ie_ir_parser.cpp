@@ -6,6 +6,7 @@
 
 #include <ie_memcpy.h>
 
+#include <exception>
 #include <typeinfo>
 #include <unordered_set>
 #include <algorithm>
@@ -24,9 +25,12 @@
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 
 #include <cpp/ie_cnn_network.h>
+#include <ie_parallel.hpp>
 #include "ie_blob_stream.hpp"
+#include "ie_ir_itt.hpp"
 #include "caseless.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "generic_ie.hpp"
@@ -83,6 +87,7 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) {
 }
 
 std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::istream& binStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse");
     using node_params = struct {
         pugi::xml_node xml;
         GenericLayerParams params;
@@ -93,14 +98,35 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
     std::unordered_set<std::string> opName;
 
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
-        if (opName.find(node_param.name) != opName.end())
-            THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
-        opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
-        if (node_param.type == "Result" || node_param.type == "Assign") {
-            outputs.push_back(node_param.layerId);
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse::ParseLayers");
+        std::vector<pugi::xml_node> layers;
+        FOREACH_CHILD(node, root.child("layers"), "layer") {
+            layers.push_back(node);
+        }
+
+        // Layers are parsed independently, errors are reported in the order of layers in IR
+        std::vector<GenericLayerParams> layersParams(layers.size());
+        std::vector<std::exception_ptr> errors(layers.size());
+        parallel_for(layers.size(), [&](size_t i) {
+            try {
+                layersParams[i] = parseGenericParams(layers[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+
+        for (size_t i = 0; i < layers.size(); i++) {
+            if (errors[i])
+                std::rethrow_exception(errors[i]);
+            auto& node_param = layersParams[i];
+            if (opName.find(node_param.name) != opName.end())
+                THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
+            opName.insert(node_param.name);
+            if (node_param.type == "Result" || node_param.type == "Assign") {
+                outputs.push_back(node_param.layerId);
+            }
+            params[node_param.layerId] = {layers[i], std::move(node_param)};
         }
     }
 
@@ -130,6 +156,37 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    // Constants don't have inputs and weights from a blob stream are shared with them without reading the stream,
+    // so they are created in parallel. Other operations are connected to their inputs on creation,
+    // which is not thread safe for nodes with common producers, so they are created sequentially.
+    if (details::getBlobStream(binStream) != nullptr) {
+        OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse::CreateConstants");
+        InferenceEngine::details::CaselessEq<std::string> comparator;
+        std::vector<size_t> constants;
+        for (auto& layer_id : order) {
+            const auto& p = params[layer_id].params;
+            if (comparator(p.type, "Const") && p.version.find("opset") == 0 && edges[layer_id].empty())
+                constants.push_back(layer_id);
+        }
+
+        std::vector<std::shared_ptr<ngraph::Node>> nodes(constants.size());
+        std::vector<std::exception_ptr> errors(constants.size());
+        parallel_for(constants.size(), [&](size_t i) {
+            try {
+                const auto& p = params.at(constants[i]);
+                nodes[i] = createNode({}, p.xml, binStream, p.params);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+
+        for (size_t i = 0; i < constants.size(); i++) {
+            if (errors[i])
+                std::rethrow_exception(errors[i]);
+            id_to_node[constants[i]] = nodes[i];
+        }
+    }
+
     ngraph::ParameterVector parameter_nodes;
     ngraph::ResultVector result_nodes;
     ngraph::NodeVector allNodes;
@@ -137,57 +194,68 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
     //  Following topological order create nGraph operations
-    for (auto& layer_id : order) {
-        auto& p = params[layer_id];
-        ngraph::OutputVector inputs(edges[layer_id].size());
-        for (auto& e : edges[layer_id]) {
-            auto input_node = id_to_node[e.fromLayerId];
-            if (!input_node) {
-                THROW_IE_EXCEPTION << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse::CreateNodes");
+        for (auto& layer_id : order) {
+            auto& p = params[layer_id];
+            ngraph::OutputVector inputs(edges[layer_id].size());
+            for (auto& e : edges[layer_id]) {
+                auto input_node = id_to_node[e.fromLayerId];
+                if (!input_node) {
+                    THROW_IE_EXCEPTION << "Attempt to access node " << e.fromLayerId << " that not in graph.";
+                }
+                auto& p_output = params[e.fromLayerId].params;
+                if (p.params.getRealInputPortId(e.toPortId) >= inputs.size())
+                    THROW_IE_EXCEPTION << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
+                        << " is inconsistent!";
+                inputs[p.params.getRealInputPortId(e.toPortId)] =
+                    input_node->output(p_output.getRealOutputPortId(e.fromPortId));
             }
-            auto& p_output = params[e.fromLayerId].params;
-            if (p.params.getRealInputPortId(e.toPortId) >= inputs.size())
-                THROW_IE_EXCEPTION << p.params.type << " layer " << p.params.name << " with id: " << p.params.layerId
-                    << " is inconsistent!";
-            inputs[p.params.getRealInputPortId(e.toPortId)] =
-                input_node->output(p_output.getRealOutputPortId(e.fromPortId));
-        }
 
-        auto node = createNode(inputs, p.xml, binStream, p.params);
-        id_to_node[layer_id] = node;
-
-        // Check that output shape after nGraph node validation the same as in IR
-        // because IR always right!
-        // Temporary disabled!
-        //        for (size_t i = 0; i < p.params.outputPorts.size(); ++i) {
-        //            if (p.params.outputPorts[i].dims != node->output(i).get_shape()) {
-        //                THROW_IE_EXCEPTION << "Shape after nGraph infer " <<
-        //                details::dumpVec(node->output(i).get_shape())
-        //                                   << " differ from IR shapes: " <<
-        //                                   details::dumpVec(p.params.outputPorts[i].dims);
-        //            }
-        //        }
-
-        if (auto parameter_node = std::dynamic_pointer_cast<ngraph::op::Parameter>(node)) {
-            parameter_nodes.emplace_back(parameter_node);
-        }
+            // Constants may be already created
+            auto node = id_to_node[layer_id];
+            if (!node) {
+                node = createNode(inputs, p.xml, binStream, p.params);
+                id_to_node[layer_id] = node;
+            }
 
-        if (auto result_node = std::dynamic_pointer_cast<ngraph::op::Result>(node)) {
-            result_nodes.emplace_back(result_node);
-        }
+            // Check that output shape after nGraph node validation the same as in IR
+            // because IR always right!
+            // Temporary disabled!
+            //        for (size_t i = 0; i < p.params.outputPorts.size(); ++i) {
+            //            if (p.params.outputPorts[i].dims != node->output(i).get_shape()) {
+            //                THROW_IE_EXCEPTION << "Shape after nGraph infer " <<
+            //                details::dumpVec(node->output(i).get_shape())
+            //                                   << " differ from IR shapes: " <<
+            //                                   details::dumpVec(p.params.outputPorts[i].dims);
+            //            }
+            //        }
+
+            if (auto parameter_node = std::dynamic_pointer_cast<ngraph::op::Parameter>(node)) {
+                parameter_nodes.emplace_back(parameter_node);
+            }
 
-        if (auto assign_node = std::dynamic_pointer_cast<ngraph::op::Assign>(node)) {
-            assign_nodes.emplace_back(assign_node);
-        }
+            if (auto result_node = std::dynamic_pointer_cast<ngraph::op::Result>(node)) {
+                result_nodes.emplace_back(result_node);
+            }
+
+            if (auto assign_node = std::dynamic_pointer_cast<ngraph::op::Assign>(node)) {
+                assign_nodes.emplace_back(assign_node);
+            }
 
-        if (auto read_value_node = std::dynamic_pointer_cast<ngraph::op::ReadValue>(node)) {
-            variable_id_to_read_value[read_value_node->get_variable_id()] = read_value_node;
+            if (auto read_value_node = std::dynamic_pointer_cast<ngraph::op::ReadValue>(node)) {
+                variable_id_to_read_value[read_value_node->get_variable_id()] = read_value_node;
+            }
+            allNodes.emplace_back(node);
         }
-        allNodes.emplace_back(node);
     }
 
-    ::ngraph::op::GenericIE::DisableReshape noReshape(allNodes);
-    auto function = std::make_shared<ngraph::Function>(result_nodes, parameter_nodes, GetStrAttr(root, "name", ""));
+    std::shared_ptr<ngraph::Function> function;
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "V10Parser::parse::CreateFunction");
+        ::ngraph::op::GenericIE::DisableReshape noReshape(allNodes);
+        function = std::make_shared<ngraph::Function>(result_nodes, parameter_nodes, GetStrAttr(root, "name", ""));
+    }
     if (!result_nodes.empty()) {
         for (const auto& assign : assign_nodes) {
             assign->add_control_dependency(variable_id_to_read_value.at(assign->get_variable_id()));
@@ -1420,8 +1488,17 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::cre
     size_t offset = GetUInt64Attr(dn, "offset");
     size_t size = GetUInt64Attr(dn, "size");
 
-    binStream.seekg(0, std::ios::end);
-    std::streampos length = binStream.tellg();
+    // Blob stream position is not used, so constants can be created from different threads
+    details::BlobStream* blobStream = details::getBlobStream(binStream);
+    Blob::CPtr weights;
+    std::streampos length;
+    if (blobStream != nullptr) {
+        weights = blobStream->getBlob();
+        length = weights ? weights->byteSize() : 0;
+    } else {
+        binStream.seekg(0, std::ios::end);
+        length = binStream.tellg();
+    }
     if (!length)
         THROW_IE_EXCEPTION << "Cannot read network! The model requires weights data! "
             << "Bin file cannot be found! Please specify the path to bin file.";
@@ -1435,6 +1512,13 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::cre
     if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
         THROW_IE_EXCEPTION << "Cannot create Constant op " << layerParsePrms.name << " size attribute and shape size are inconsistent!";
 
+    // Weights which are already in memory (e.g. memory mapped bin file) are shared with Constant without copy
+    if (blobStream != nullptr) {
+        char* data = weights->cbuffer().as<char*>() + offset;
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, size, weights);
+        return std::make_shared<ngraph::op::Constant>(port.precision, shape, buffer);
+    }
+
     auto constant = std::make_shared<ngraph::op::Constant>(port.precision, shape);
     char* data = const_cast<char*>(reinterpret_cast<const char*>(constant->get_data_ptr()));
     binStream.seekg(offset, std::ios::beg);
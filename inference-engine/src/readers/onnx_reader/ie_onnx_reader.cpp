@@ -25,6 +25,12 @@ CNNNetwork ONNXReader::read(std::istream& model, const std::vector<IExtensionPtr
     return CNNNetwork(ngraph::onnx_import::import_onnx_model(model));
 }
 
+CNNNetwork ONNXReader::readFile(std::istream& model, const std::string& modelPath,
+                                const std::vector<IExtensionPtr>& exts) const {
+    // external data files of the model are located relatively to the model file
+    return CNNNetwork(ngraph::onnx_import::import_onnx_model(model, modelPath));
+}
+
 INFERENCE_PLUGIN_API(StatusCode) InferenceEngine::CreateReader(IReader*& reader, ResponseDesc *resp) noexcept {
     try {
         reader = new ONNXReader();
@@ -38,6 +38,16 @@ public:
     CNNNetwork read(std::istream& model, std::istream& weights, const std::vector<IExtensionPtr>& exts) const override {
         THROW_IE_EXCEPTION << "ONNX reader cannot read model with weights!";
     }
+    /**
+     * @brief Reads the model from a file to CNNNetwork, external data files are located relatively to the model file
+     * @param model stream with model
+     * @param modelPath path to the model file
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork readFile(std::istream& model, const std::string& modelPath,
+                        const std::vector<IExtensionPtr>& exts) const override;
 
     std::vector<std::string> getDataFileExtensions() const override {
         return {};
@@ -6,6 +6,8 @@
 
 #include <ie_blob.h>
 #include <istream>
+#include <string>
+#include <typeinfo>
 
 namespace InferenceEngine {
 namespace details {
@@ -30,6 +32,24 @@ public:
     Blob::CPtr getBlob();
 };
 
+/**
+ * @brief Returns the stream as BlobStream to work with the original blob without reading
+ * @note Type names are compared if dynamic_cast fails, because type info of the stream created in other library
+ * may differ
+ * @param stream Input stream
+ * @return Pointer to BlobStream or nullptr if the stream is not a BlobStream
+ */
+inline BlobStream* getBlobStream(std::istream& stream) {
+    BlobStream* blobStream = dynamic_cast<BlobStream*>(&stream);
+    if (blobStream == nullptr) {
+        BlobStream helper({});
+        std::string typeStream = typeid(stream).name();
+        std::string typeBlobStream = typeid(helper).name();
+        if (typeStream == typeBlobStream)
+            blobStream = static_cast<BlobStream*>(&stream);
+    }
+    return blobStream;
+}
 
 }  // namespace details
 }  // namespace InferenceEngine
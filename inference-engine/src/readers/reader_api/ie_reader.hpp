@@ -42,6 +42,18 @@ public:
      * @return CNNNetwork
      */
     virtual CNNNetwork read(std::istream& model, std::istream& weights, const std::vector<IExtensionPtr>& exts) const = 0;
+    /**
+     * @brief Reads the model from a file to CNNNetwork, the default implementation ignores the path
+     * @param model stream with model
+     * @param modelPath path to the model file, readers use it to find files the model refers to
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    virtual CNNNetwork readFile(std::istream& model, const std::string& modelPath,
+                                const std::vector<IExtensionPtr>& exts) const {
+        return read(model, exts);
+    }
 
     /**
      * @brief Returns all supported extensions for data files
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <sstream>
+#include <ngraph/op/constant.hpp>
+#include "ngraph_reader_tests.hpp"
+
+namespace {
+
+// Parameter followed by a chain of Add layers, every Add takes its own constant
+std::string makeAddChainIR(size_t constants, const std::string& firstConstDim = "1", const std::string& lastConstDim = "1") {
+    std::stringstream model;
+    model << R"V0G0N(<net name="Network" version="10"><layers>
+        <layer id="0" name="data" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1"/>
+            <output><port id="0" precision="FP32"><dim>1</dim></port></output>
+        </layer>)V0G0N";
+    for (size_t i = 0; i < constants; i++) {
+        std::string dim = i == 0 ? firstConstDim : (i + 1 == constants ? lastConstDim : "1");
+        model << "<layer id=\"" << 2 * i + 1 << "\" name=\"const_" << i << "\" type=\"Const\" version=\"opset1\">"
+              << "<data offset=\"" << i * sizeof(float) << "\" size=\"" << sizeof(float) << "\"/>"
+              << "<output><port id=\"1\" precision=\"FP32\"><dim>" << dim << "</dim></port></output></layer>";
+        model << "<layer id=\"" << 2 * i + 2 << "\" name=\"add_" << i << "\" type=\"Add\" version=\"opset1\">"
+              << "<input><port id=\"0\"><dim>1</dim></port><port id=\"1\"><dim>1</dim></port></input>"
+              << "<output><port id=\"2\" precision=\"FP32\"><dim>1</dim></port></output></layer>";
+    }
+    model << "<layer id=\"" << 2 * constants + 1 << "\" name=\"output\" type=\"Result\" version=\"opset1\">"
+          << "<input><port id=\"0\"><dim>1</dim></port></input></layer></layers><edges>";
+    for (size_t i = 0; i < constants; i++) {
+        model << "<edge from-layer=\"" << (i == 0 ? 0 : 2 * i) << "\" from-port=\"" << (i == 0 ? 0 : 2)
+              << "\" to-layer=\"" << 2 * i + 2 << "\" to-port=\"0\"/>";
+        model << "<edge from-layer=\"" << 2 * i + 1 << "\" from-port=\"1\" to-layer=\"" << 2 * i + 2
+              << "\" to-port=\"1\"/>";
+    }
+    model << "<edge from-layer=\"" << 2 * constants << "\" from-port=\"2\" to-layer=\"" << 2 * constants + 1
+          << "\" to-port=\"0\"/></edges></net>";
+    return model.str();
+}
+
+Blob::Ptr makeWeights(size_t constants) {
+    auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {constants * sizeof(float)}, Layout::C));
+    weights->allocate();
+    auto data = weights->buffer().as<float*>();
+    for (size_t i = 0; i < constants; i++) {
+        data[i] = static_cast<float>(i);
+    }
+    return weights;
+}
+
+}  // namespace
+
+TEST_F(NGraphReaderTests, ReadNetworkWithManyConstants) {
+    const size_t constants = 256;
+    Core ie;
+    auto network = ie.ReadNetwork(makeAddChainIR(constants), makeWeights(constants));
+    auto function = network.getFunction();
+    ASSERT_NE(nullptr, function);
+
+    size_t found = 0;
+    for (const auto& op : function->get_ops()) {
+        auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op);
+        if (!constant)
+            continue;
+        const auto& name = constant->get_friendly_name();
+        ASSERT_EQ(0, name.find("const_"));
+        auto index = std::stoul(name.substr(6));
+        ASSERT_EQ(static_cast<float>(index), constant->cast_vector<float>()[0]);
+        found++;
+    }
+    ASSERT_EQ(constants, found);
+}
+
+TEST_F(NGraphReaderTests, ReadNetworkReportsFirstInvalidLayer) {
+    const size_t constants = 64;
+    Core ie;
+    try {
+        ie.ReadNetwork(makeAddChainIR(constants, "first", "last"), makeWeights(constants));
+        FAIL() << "Invalid IR is read";
+    } catch (const details::InferenceEngineException& ex) {
+        ASSERT_NE(std::string::npos, std::string(ex.what()).find("dimension (first)"));
+    }
+}
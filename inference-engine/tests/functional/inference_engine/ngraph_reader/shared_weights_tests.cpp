@@ -0,0 +1,118 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <ngraph/op/constant.hpp>
+#include "ngraph_reader_tests.hpp"
+
+TEST_F(NGraphReaderTests, ReadNetworkSharesWeightsFromBinFile) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="data" type="Parameter" version="opset1">
+            <data element_type="f32" shape="4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="const_1" type="Const" version="opset1">
+            <data offset="0" size="16"/>
+            <output>
+                <port id="1" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="add_1" type="Add" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="const_2" type="Const" version="opset1">
+            <data offset="20" size="16"/>
+            <output>
+                <port id="1" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="add_2" type="Add" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="5" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="3" from-port="1" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    const std::string xmlPath = "shared_weights_test.xml";
+    const std::string binPath = "shared_weights_test.bin";
+    std::vector<float> weights = {1.f, 2.f, 3.f, 4.f, 0.f, 5.f, 6.f, 7.f, 8.f};
+    CommonTestUtils::createFile(xmlPath, model);
+    {
+        std::ofstream bin(binPath, std::ios::binary);
+        bin.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(float));
+    }
+
+    std::shared_ptr<ngraph::op::Constant> const1, const2;
+    {
+        Core ie;
+        auto network = ie.ReadNetwork(xmlPath, binPath);
+        for (const auto& op : network.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "const_1")
+                const1 = std::dynamic_pointer_cast<ngraph::op::Constant>(op);
+            if (op->get_friendly_name() == "const_2")
+                const2 = std::dynamic_pointer_cast<ngraph::op::Constant>(op);
+        }
+    }
+    CommonTestUtils::removeIRFiles(xmlPath, binPath);
+
+    ASSERT_NE(nullptr, const1);
+    ASSERT_NE(nullptr, const2);
+    // Constants which own copies of data are allocated separately with alignment much larger than 20 bytes,
+    // so data pointers keep the distance from the bin file only if both constants point to the same mapping
+    auto data1 = static_cast<const char*>(const1->get_data_ptr());
+    auto data2 = static_cast<const char*>(const2->get_data_ptr());
+    ASSERT_EQ(20, data2 - data1);
+    // Mapping is kept alive by constants after the network and the files are destroyed
+    ASSERT_EQ(std::vector<float>({1.f, 2.f, 3.f, 4.f}), const1->cast_vector<float>());
+    ASSERT_EQ(std::vector<float>({5.f, 6.f, 7.f, 8.f}), const2->cast_vector<float>());
+}
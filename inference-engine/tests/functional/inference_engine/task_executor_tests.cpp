@@ -9,6 +9,7 @@
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <threading/ie_priority_executor.hpp>
 #include <ie_system_conf.h>
 
 using namespace ::testing;
@@ -186,6 +187,69 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, realtimeTasksAreExecutedBeforeBulkTasks) {
+    std::vector<int> order;
+    std::mutex orderMutex;
+    {
+        CPUStreamsExecutor taskExecutor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1}};
+        std::promise<void> unblock;
+        auto unblocked = unblock.get_future().share();
+        // occupy the only stream while tasks are enqueued
+        taskExecutor.run([unblocked] { unblocked.wait(); });
+        for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+            taskExecutor.run([&, i] {
+                std::lock_guard<std::mutex> lock{orderMutex};
+                order.push_back(MAX_NUMBER_OF_TASKS_IN_QUEUE + i);
+            }, IStreamsExecutor::TaskPriority::BULK);
+        }
+        for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+            taskExecutor.run([&, i] {
+                std::lock_guard<std::mutex> lock{orderMutex};
+                order.push_back(i);
+            }, IStreamsExecutor::TaskPriority::REALTIME);
+        }
+        unblock.set_value();
+    }
+    ASSERT_EQ(2 * MAX_NUMBER_OF_TASKS_IN_QUEUE, order.size());
+    for (int i = 0; i < 2 * MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        ASSERT_EQ(i, order[i]);
+    }
+}
+
+TEST(CPUStreamsExecutorTests, highPriorityRequestTasksOvertakeNormalOnesInSharedExecutor) {
+    std::vector<int> order;
+    std::mutex orderMutex;
+    {
+        auto streamsExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+        // stage executors of two infer request pipelines sharing the same streams
+        auto normalExecutor = std::make_shared<PriorityExecutor>(streamsExecutor, IStreamsExecutor::TaskPriority::NORMAL);
+        auto highExecutor = std::make_shared<PriorityExecutor>(streamsExecutor, IStreamsExecutor::TaskPriority::NORMAL);
+        highExecutor->SetPriority(IStreamsExecutor::TaskPriority::REALTIME);
+        std::promise<void> unblock;
+        auto unblocked = unblock.get_future().share();
+        // occupy the only stream while tasks are enqueued
+        streamsExecutor->run([unblocked] { unblocked.wait(); });
+        for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+            ITaskExecutor::Ptr executor = (i % 2) ? normalExecutor : ITaskExecutor::Ptr{streamsExecutor};
+            executor->run([&, i] {
+                std::lock_guard<std::mutex> lock{orderMutex};
+                order.push_back(MAX_NUMBER_OF_TASKS_IN_QUEUE + i);
+            });
+        }
+        for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+            highExecutor->run([&, i] {
+                std::lock_guard<std::mutex> lock{orderMutex};
+                order.push_back(i);
+            });
+        }
+        unblock.set_value();
+    }
+    ASSERT_EQ(2 * MAX_NUMBER_OF_TASKS_IN_QUEUE, order.size());
+    for (int i = 0; i < 2 * MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        ASSERT_EQ(i, order[i]);
+    }
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -0,0 +1,106 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <cpp_interfaces/exception2status.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+using ImportExportParams = std::tuple<
+        std::string,                          // network name
+        std::shared_ptr<ngraph::Function>,    // network
+        bool>;                                // mean values preprocessing
+
+class CPUImportExportTests : public ::testing::TestWithParam<ImportExportParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ImportExportParams>& obj) {
+        return std::get<0>(obj.param) + (std::get<2>(obj.param) ? "_meanValues" : "");
+    }
+
+protected:
+    static std::map<std::string, Blob::Ptr> infer(ExecutableNetwork& executableNetwork,
+                                                  const std::map<std::string, Blob::Ptr>& inputs) {
+        auto request = executableNetwork.CreateInferRequest();
+        for (auto&& input : inputs) {
+            request.SetBlob(input.first, input.second);
+        }
+        request.Infer();
+        std::map<std::string, Blob::Ptr> outputs;
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            outputs[output.first] = request.GetBlob(output.first);
+        }
+        return outputs;
+    }
+};
+
+TEST_P(CPUImportExportTests, importedNetworkInfersTheSameAsExported) {
+    CNNNetwork network(std::get<1>(GetParam()));
+    if (std::get<2>(GetParam())) {
+        for (auto&& input : network.getInputsInfo()) {
+            auto& preProcess = input.second->getPreProcess();
+            auto channels = input.second->getTensorDesc().getDims()[1];
+            preProcess.init(channels);
+            for (size_t c = 0; c < channels; c++) {
+                preProcess[c]->meanValue = 0.5f * c;
+                preProcess[c]->stdScale = 1.0f + c;
+            }
+            preProcess.setVariant(MEAN_VALUE);
+        }
+    }
+
+    Core ie;
+    auto exported = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    std::stringstream model;
+    try {
+        exported.Export(model);
+    } catch (const NotImplemented& ex) {
+        ASSERT_NE(std::string::npos, std::string(ex.what()).find("IR v7 reader"));
+        GTEST_SKIP() << ex.what();
+    }
+    auto imported = ie.ImportNetwork(model, CommonTestUtils::DEVICE_CPU);
+
+    ASSERT_EQ(exported.GetInputsInfo().size(), imported.GetInputsInfo().size());
+    ASSERT_EQ(exported.GetOutputsInfo().size(), imported.GetOutputsInfo().size());
+
+    std::map<std::string, Blob::Ptr> inputs;
+    for (auto&& input : exported.GetInputsInfo()) {
+        auto importedInput = imported.GetInputsInfo().find(input.first);
+        ASSERT_NE(imported.GetInputsInfo().end(), importedInput);
+        ASSERT_EQ(input.second->getTensorDesc(), importedInput->second->getTensorDesc());
+        inputs[input.first] = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc());
+    }
+
+    auto expected = infer(exported, inputs);
+    auto actual = infer(imported, inputs);
+    for (auto&& output : expected) {
+        auto importedOutput = actual.find(output.first);
+        ASSERT_NE(actual.end(), importedOutput);
+        FuncTestUtils::compareBlobs(importedOutput->second, output.second, 0.0f);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUImportExport, CPUImportExportTests,
+        ::testing::Values(
+            std::make_tuple("ConvPoolRelu", ngraph::builder::subgraph::makeConvPoolRelu(), false),
+            std::make_tuple("SplitConvConcat", ngraph::builder::subgraph::makeSplitConvConcat(), false),
+            std::make_tuple("SplitConvConcat", ngraph::builder::subgraph::makeSplitConvConcat(), true)),
+        CPUImportExportTests::getTestCaseName);
+
+}  // namespace
@@ -0,0 +1,87 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+using InterOpParallelParams = std::tuple<
+        std::string,                          // network name
+        std::shared_ptr<ngraph::Function>,    // network
+        std::string>;                         // number of streams
+
+class CPUInterOpParallelTests : public ::testing::TestWithParam<InterOpParallelParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterOpParallelParams>& obj) {
+        return std::get<0>(obj.param) + "_streams=" + std::get<2>(obj.param);
+    }
+
+protected:
+    static std::map<std::string, Blob::Ptr> infer(ExecutableNetwork& executableNetwork,
+                                                  const std::map<std::string, Blob::Ptr>& inputs) {
+        auto request = executableNetwork.CreateInferRequest();
+        for (auto&& input : inputs) {
+            request.SetBlob(input.first, input.second);
+        }
+        request.Infer();
+        std::map<std::string, Blob::Ptr> outputs;
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            outputs[output.first] = request.GetBlob(output.first);
+        }
+        return outputs;
+    }
+};
+
+TEST_P(CPUInterOpParallelTests, interOpParallelInfersTheSameAsSequential) {
+    CNNNetwork network(std::get<1>(GetParam()));
+    const auto& streams = std::get<2>(GetParam());
+
+    Core ie;
+    auto sequential = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                     {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams},
+                                      {"CPU_INTER_OP_PARALLEL", PluginConfigParams::NO}});
+    auto interOp = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams},
+                                   {"CPU_INTER_OP_PARALLEL", PluginConfigParams::YES}});
+
+    std::map<std::string, Blob::Ptr> inputs;
+    for (auto&& input : sequential.GetInputsInfo()) {
+        inputs[input.first] = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc());
+    }
+
+    auto expected = infer(sequential, inputs);
+    // several runs to catch races between nodes of the same level
+    for (int i = 0; i < 3; i++) {
+        auto actual = infer(interOp, inputs);
+        for (auto&& output : expected) {
+            auto interOpOutput = actual.find(output.first);
+            ASSERT_NE(actual.end(), interOpOutput);
+            FuncTestUtils::compareBlobs(interOpOutput->second, output.second, 0.0f);
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUInterOpParallel, CPUInterOpParallelTests,
+        ::testing::Values(
+            std::make_tuple("SplitMultiConvConcat", ngraph::builder::subgraph::makeSplitMultiConvConcat(), "1"),
+            std::make_tuple("NestedSplitConvConcat", ngraph::builder::subgraph::makeNestedSplitConvConcat(), "1"),
+            std::make_tuple("SplitConvConcatNestedInBranch", ngraph::builder::subgraph::makeSplitConvConcatNestedInBranch(), "1"),
+            std::make_tuple("SplitConvConcatNestedInBranch", ngraph::builder::subgraph::makeSplitConvConcatNestedInBranch(), "2")),
+        CPUInterOpParallelTests::getTestCaseName);
+
+}  // namespace
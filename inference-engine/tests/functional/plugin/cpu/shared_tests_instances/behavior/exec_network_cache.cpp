@@ -0,0 +1,23 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "behavior/exec_network_cache.hpp"
+
+using namespace BehaviorTestsDefinitions;
+
+namespace {
+
+const std::vector<std::map<std::string, std::string>> configs = {
+    {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "1"}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, ExecNetworkCacheTests,
+                        ::testing::Combine(
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                ::testing::ValuesIn(configs)),
+                        ExecNetworkCacheTests::getTestCaseName);
+
+}  // namespace
@@ -4,8 +4,12 @@
 
 #include <vector>
 
+#include <functional_test_utils/plugin_cache.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
 #include "behavior/infer_request.hpp"
 #include "ie_plugin_config.hpp"
+#include "hetero/hetero_plugin_config.hpp"
+#include "multi-device/multi_device_config.hpp"
 
 using namespace BehaviorTestsDefinitions;
 namespace {
@@ -21,7 +25,11 @@ namespace {
     };
 
     const std::vector<std::map<std::string, std::string>> Multiconfigs = {
-            {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
+            {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}},
+            {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU},
+             { MULTI_CONFIG_KEY(SCHEDULING_POLICY) , MULTI_CONFIG_VALUE(EARLIEST_COMPLETION)}},
+            {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU},
+             { MULTI_CONFIG_KEY(SCHEDULING_POLICY) , MULTI_CONFIG_VALUE(THROUGHPUT_PROPORTIONAL)}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, InferRequestTests,
@@ -37,4 +45,70 @@ namespace {
                                     ::testing::Values(CommonTestUtils::DEVICE_MULTI),
                                     ::testing::ValuesIn(Multiconfigs)),
                             InferRequestTests::getTestCaseName);
+
+    TEST(MultiSchedulingPolicyTest, smoke_DeviceStatisticsAreCollected) {
+        InferenceEngine::CNNNetwork cnnNet(ngraph::builder::subgraph::makeConvPoolRelu());
+        auto execNet = PluginCache::get().ie()->LoadNetwork(cnnNet, CommonTestUtils::DEVICE_MULTI, {
+            { MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU},
+            { MULTI_CONFIG_KEY(SCHEDULING_POLICY) , MULTI_CONFIG_VALUE(EARLIEST_COMPLETION)}});
+
+        const size_t numInfers = 10;
+        std::vector<InferenceEngine::InferRequest> requests(2);
+        for (auto& req : requests) {
+            req = execNet.CreateInferRequest();
+        }
+        for (size_t i = 0; i < numInfers; i += requests.size()) {
+            for (auto& req : requests) {
+                req.StartAsync();
+            }
+            for (auto& req : requests) {
+                ASSERT_EQ(InferenceEngine::StatusCode::OK, req.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            }
+        }
+
+        std::map<std::string, std::map<std::string, double>> statistics = execNet.GetMetric(MULTI_METRIC(DEVICE_STATISTICS));
+        ASSERT_EQ(1, statistics.count(CommonTestUtils::DEVICE_CPU));
+        auto& cpuStatistics = statistics[CommonTestUtils::DEVICE_CPU];
+        ASSERT_EQ(numInfers, cpuStatistics["COMPLETED_REQUESTS"]);
+        ASSERT_EQ(0, cpuStatistics["QUEUE_DEPTH"]);
+        ASSERT_LT(0, cpuStatistics["NUM_REQUESTS"]);
+        ASSERT_LT(0, cpuStatistics["LATENCY_MS"]);
+
+        ASSERT_NO_THROW(execNet.SetConfig({{ MULTI_CONFIG_KEY(SCHEDULING_POLICY) , MULTI_CONFIG_VALUE(PRIORITY)}}));
+        ASSERT_EQ(std::string{MULTI_CONFIG_VALUE(PRIORITY)}, execNet.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>());
+        ASSERT_THROW(execNet.SetConfig({{ MULTI_CONFIG_KEY(SCHEDULING_POLICY) , "ROUND_ROBIN"}}),
+                     InferenceEngine::details::InferenceEngineException);
+    }
+
+    TEST(HeteroOptimalNumberOfInferRequestsTest, smoke_EqualsDeviceValueForSingleDevice) {
+        InferenceEngine::CNNNetwork cnnNet(ngraph::builder::subgraph::makeSplitConvConcat());
+        std::map<std::string, std::string> config = {
+            {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}};
+        auto ie = PluginCache::get().ie();
+        auto cpuExecNet = ie->LoadNetwork(cnnNet, CommonTestUtils::DEVICE_CPU, config);
+        config["TARGET_FALLBACK"] = CommonTestUtils::DEVICE_CPU;
+        auto heteroExecNet = ie->LoadNetwork(cnnNet, CommonTestUtils::DEVICE_HETERO, config);
+
+        unsigned int cpuValue = cpuExecNet.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        unsigned int heteroValue = heteroExecNet.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        ASSERT_EQ(2u, cpuValue);
+        ASSERT_EQ(cpuValue, heteroValue);
+    }
+
+    TEST(HeteroPartitioningPolicyTest, smoke_MinLatencyPolicyInfers) {
+        InferenceEngine::CNNNetwork cnnNet(ngraph::builder::subgraph::makeConvPoolRelu());
+        auto ie = PluginCache::get().ie();
+        auto execNet = ie->LoadNetwork(cnnNet, CommonTestUtils::DEVICE_HETERO, {
+            { "TARGET_FALLBACK", CommonTestUtils::DEVICE_CPU },
+            { HETERO_CONFIG_KEY(PARTITIONING_POLICY), HETERO_CONFIG_VALUE(MIN_LATENCY) }});
+        ASSERT_EQ(std::string{HETERO_CONFIG_VALUE(MIN_LATENCY)},
+                  execNet.GetConfig(HETERO_CONFIG_KEY(PARTITIONING_POLICY)).as<std::string>());
+        auto req = execNet.CreateInferRequest();
+        ASSERT_NO_THROW(req.Infer());
+
+        ASSERT_THROW(ie->LoadNetwork(cnnNet, CommonTestUtils::DEVICE_HETERO, {
+            { "TARGET_FALLBACK", CommonTestUtils::DEVICE_CPU },
+            { HETERO_CONFIG_KEY(PARTITIONING_POLICY), "FIRST_FIT" }}),
+                     InferenceEngine::details::InferenceEngineException);
+    }
 }  // namespace
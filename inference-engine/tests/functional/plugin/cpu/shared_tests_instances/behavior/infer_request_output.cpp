@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <functional_test_utils/plugin_cache.hpp>
+#include <ngraph/opsets/opset1.hpp>
 #include "multi-device/multi_device_config.hpp"
 
 #include "behavior/infer_request_output.hpp"
@@ -37,4 +40,52 @@ namespace {
                                     ::testing::ValuesIn(multiConfigs)),
                             InferRequestOutputTests::getTestCaseName);
 
+    // Inputs of in-place concat are views on the output memory, so user blobs are written without copy
+    TEST(InferRequestOutputCPUTest, smoke_ConcatOutputIsWrittenToUserBlob) {
+        const size_t C = 4, H = 3, W = 5;
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, C, H, W});
+        auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+        auto negRelu = std::make_shared<ngraph::opset1::Relu>(std::make_shared<ngraph::opset1::Negative>(param));
+        auto concat = std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{relu, negRelu}, 1);
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(concat)},
+                                                           ngraph::ParameterVector{param});
+
+        InferenceEngine::CNNNetwork cnnNet(function);
+        const auto inputName = cnnNet.getInputsInfo().begin()->first;
+        const auto outputName = cnnNet.getOutputsInfo().begin()->first;
+        auto execNet = PluginCache::get().ie()->LoadNetwork(cnnNet, CommonTestUtils::DEVICE_CPU);
+
+        std::vector<InferenceEngine::InferRequest> requests;
+        std::vector<InferenceEngine::Blob::Ptr> outputs;
+        for (int r = 0; r < 2; r++) {
+            auto req = execNet.CreateInferRequest();
+            auto input = req.GetBlob(inputName);
+            auto inputData = input->buffer().as<float*>();
+            for (size_t i = 0; i < input->size(); i++) {
+                inputData[i] = static_cast<float>(i % 7) - 3.f + r;
+            }
+            auto output = InferenceEngine::make_shared_blob<float>(req.GetBlob(outputName)->getTensorDesc());
+            output->allocate();
+            req.SetBlob(outputName, output);
+            requests.push_back(req);
+            outputs.push_back(output);
+        }
+        for (auto& req : requests) {
+            ASSERT_NO_THROW(req.Infer());
+        }
+
+        for (int r = 0; r < 2; r++) {
+            auto inputData = requests[r].GetBlob(inputName)->cbuffer().as<const float*>();
+            auto outputData = outputs[r]->cbuffer().as<const float*>();
+            for (size_t i = 0; i < C * H * W; i++) {
+                ASSERT_EQ(std::max(inputData[i], 0.f), outputData[i]);
+                ASSERT_EQ(std::max(-inputData[i], 0.f), outputData[C * H * W + i]);
+            }
+        }
+
+        std::map<std::string, bool> zeroCopy = execNet.GetMetric(METRIC_KEY(OUTPUTS_ZERO_COPY));
+        ASSERT_EQ(1, zeroCopy.count(outputName));
+        ASSERT_TRUE(zeroCopy[outputName]);
+    }
+
 }  // namespace
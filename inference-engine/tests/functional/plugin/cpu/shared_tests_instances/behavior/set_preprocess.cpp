@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cmath>
+
 #include <functional_test_utils/behavior_test_utils.hpp>
+#include <functional_test_utils/plugin_cache.hpp>
+#include <ngraph/opsets/opset1.hpp>
 #include "multi-device/multi_device_config.hpp"
 
 #include "behavior/set_preprocess.hpp"
@@ -37,4 +42,99 @@ namespace {
                                     ::testing::Values(CommonTestUtils::DEVICE_MULTI),
                                     ::testing::ValuesIn(multiConfigs)),
                             PreprocessTest::getTestCaseName);
+
+    // Mean values and scale are applied by the graph, so U8 input is accepted and folded into the convolution
+    TEST(PreprocessCPUTest, smoke_MeanValuesAndScaleWithU8Input) {
+        const size_t C = 3, OC = 2, H = 4, W = 4;
+        const std::vector<float> weights = {1.f, 2.f, 3.f, -1.f, 0.5f, 0.25f};
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, C, H, W});
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(param,
+                ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{OC, C, 1, 1}, weights),
+                ngraph::Strides{1, 1}, ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0}, ngraph::Strides{1, 1});
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(conv)},
+                                                           ngraph::ParameterVector{param});
+
+        InferenceEngine::CNNNetwork cnnNet(function);
+        auto inputInfo = cnnNet.getInputsInfo().begin()->second;
+        inputInfo->setPrecision(InferenceEngine::Precision::U8);
+        auto& preProcess = inputInfo->getPreProcess();
+        preProcess.init(C);
+        for (size_t c = 0; c < C; c++) {
+            preProcess[c]->meanValue = static_cast<float>(c + 1);
+            preProcess[c]->stdScale = 0.5f;
+        }
+        preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+
+        auto execNet = PluginCache::get().ie()->LoadNetwork(cnnNet, CommonTestUtils::DEVICE_CPU);
+        auto req = execNet.CreateInferRequest();
+        auto input = req.GetBlob(cnnNet.getInputsInfo().begin()->first);
+        auto inputData = input->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < input->size(); i++) {
+            inputData[i] = static_cast<uint8_t>(i % 50);
+        }
+        ASSERT_NO_THROW(req.Infer());
+
+        auto output = req.GetBlob(cnnNet.getOutputsInfo().begin()->first);
+        auto outputData = output->cbuffer().as<const float*>();
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t i = 0; i < H * W; i++) {
+                float expected = 0.f;
+                for (size_t c = 0; c < C; c++) {
+                    expected += weights[oc * C + c] * (inputData[c * H * W + i] - preProcess[c]->meanValue) * preProcess[c]->stdScale;
+                }
+                ASSERT_NEAR(expected, outputData[oc * H * W + i], 1e-4f);
+            }
+        }
+    }
+
+    // U8 image set for FP32 input is resized and converted by one pre-processing kernel, mean values and scale are
+    // still applied by the graph, so the result is the same as with U8 input converted by the plugin
+    TEST(PreprocessCPUTest, smoke_ResizeU8BlobIntoFP32Input) {
+        const size_t C = 3, OC = 2, H = 8, W = 8, srcH = 15, srcW = 21;
+        const std::vector<float> weights = {1.f, 2.f, 3.f, -1.f, 0.5f, 0.25f};
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, C, H, W});
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(param,
+                ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{OC, C, 1, 1}, weights),
+                ngraph::Strides{1, 1}, ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0}, ngraph::Strides{1, 1});
+        auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(conv)},
+                                                           ngraph::ParameterVector{param});
+
+        auto image = InferenceEngine::make_shared_blob<uint8_t>({InferenceEngine::Precision::U8, {1, C, srcH, srcW},
+                                                                 InferenceEngine::Layout::NHWC});
+        image->allocate();
+        auto imageData = image->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < image->size(); i++) {
+            imageData[i] = static_cast<uint8_t>((i * 37) % 251);
+        }
+
+        auto infer = [&](InferenceEngine::Precision inputPrecision) {
+            InferenceEngine::CNNNetwork cnnNet(function);
+            auto inputInfo = cnnNet.getInputsInfo().begin()->second;
+            inputInfo->setPrecision(inputPrecision);
+            auto& preProcess = inputInfo->getPreProcess();
+            preProcess.setResizeAlgorithm(InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR);
+            preProcess.init(C);
+            for (size_t c = 0; c < C; c++) {
+                preProcess[c]->meanValue = static_cast<float>(c + 100);
+                preProcess[c]->stdScale = 0.25f;
+            }
+            preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+
+            auto execNet = PluginCache::get().ie()->LoadNetwork(cnnNet, CommonTestUtils::DEVICE_CPU);
+            auto req = execNet.CreateInferRequest();
+            req.SetBlob(cnnNet.getInputsInfo().begin()->first, image);
+            req.Infer();
+            auto output = req.GetBlob(cnnNet.getOutputsInfo().begin()->first);
+            auto outputData = output->cbuffer().as<const float*>();
+            return std::vector<float>(outputData, outputData + output->size());
+        };
+
+        std::vector<float> fused, reference;
+        ASSERT_NO_THROW(fused = infer(InferenceEngine::Precision::FP32));
+        ASSERT_NO_THROW(reference = infer(InferenceEngine::Precision::U8));
+        ASSERT_EQ(reference.size(), fused.size());
+        for (size_t i = 0; i < reference.size(); i++) {
+            ASSERT_NEAR(reference[i], fused[i], 1e-4f * std::max(1.f, std::fabs(reference[i])));
+        }
+    }
 }  // namespace
\ No newline at end of file
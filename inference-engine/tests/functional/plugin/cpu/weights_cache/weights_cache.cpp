@@ -0,0 +1,78 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// Convolutions with 16 and more channels get internal blocked weight layouts which can not be expressed as TensorDesc
+std::shared_ptr<ngraph::Function> makeBlockedConvs() {
+    auto type = ngraph::element::f32;
+    auto param = std::make_shared<ngraph::opset1::Parameter>(type, ngraph::Shape{1, 16, 28, 28});
+    auto conv1 = ngraph::builder::makeConvolution(param, type, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                  ngraph::op::PadType::EXPLICIT, 32);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv1);
+    auto conv2 = ngraph::builder::makeConvolution(relu, type, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                  ngraph::op::PadType::EXPLICIT, 16);
+    auto result = std::make_shared<ngraph::opset1::Result>(conv2);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "BlockedConvs");
+}
+
+class CPUWeightsCacheTests : public ::testing::TestWithParam<bool> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<bool>& obj) {
+        return obj.param ? "BF16" : "FP32";
+    }
+
+protected:
+    static Blob::Ptr infer(ExecutableNetwork& executableNetwork, const std::string& inputName, const Blob::Ptr& input) {
+        auto request = executableNetwork.CreateInferRequest();
+        request.SetBlob(inputName, input);
+        request.Infer();
+        return request.GetBlob(executableNetwork.GetOutputsInfo().begin()->first);
+    }
+};
+
+TEST_P(CPUWeightsCacheTests, networkWithBlockedWeightsCanBeLoadedTwice) {
+    const bool enforceBF16 = GetParam();
+    if (enforceBF16 && !with_cpu_x86_bfloat16()) {
+        GTEST_SKIP() << "Platform doesn't support BF16 format";
+    }
+    std::map<std::string, std::string> config = {
+        {PluginConfigParams::KEY_ENFORCE_BF16, enforceBF16 ? PluginConfigParams::YES : PluginConfigParams::NO}};
+
+    Core ie;
+    CNNNetwork network(makeBlockedConvs());
+    // the second network with equal weights takes reordered weights from the weights cache
+    auto first = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    auto second = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = "2";
+    auto streams = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+
+    const auto& inputName = first.GetInputsInfo().begin()->first;
+    auto input = FuncTestUtils::createAndFillBlob(first.GetInputsInfo().begin()->second->getTensorDesc());
+    auto expected = infer(first, inputName, input);
+    FuncTestUtils::compareBlobs(infer(second, inputName, input), expected, 0.0f);
+    FuncTestUtils::compareBlobs(infer(streams, inputName, input), expected, 0.0f);
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUWeightsCache, CPUWeightsCacheTests,
+        ::testing::Values(false, true),
+        CPUWeightsCacheTests::getTestCaseName);
+
+}  // namespace
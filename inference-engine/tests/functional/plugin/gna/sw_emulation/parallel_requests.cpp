@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <gna/gna_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+constexpr size_t inputSize = 256;
+constexpr size_t outputSize = 128;
+
+float Weight(size_t i, size_t o) {
+    return static_cast<float>(static_cast<int>((i * 7 + o * 3) % 17) - 8) / 64.f;
+}
+
+std::shared_ptr<ngraph::Function> MakeFullyConnectedRelu() {
+    auto parameter = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, inputSize});
+    std::vector<float> weights(inputSize * outputSize);
+    for (size_t i = 0; i < inputSize; i++) {
+        for (size_t o = 0; o < outputSize; o++) {
+            weights[i * outputSize + o] = Weight(i, o);
+        }
+    }
+    auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{inputSize, outputSize}, weights);
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(parameter, constant);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(matMul);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                              ngraph::ParameterVector{parameter});
+}
+
+std::vector<float> Reference(const std::vector<float>& input) {
+    std::vector<float> output(outputSize, 0.f);
+    for (size_t o = 0; o < outputSize; o++) {
+        for (size_t i = 0; i < inputSize; i++) {
+            output[o] += input[i] * Weight(i, o);
+        }
+        output[o] = std::max(output[o], 0.f);
+    }
+    return output;
+}
+
+}  // namespace
+
+TEST(GNASoftwareEmulationTests, smoke_parallelRequestsInferIndependently) {
+    constexpr size_t requestsNum = 2;
+    Core ie;
+    CNNNetwork network(MakeFullyConnectedRelu());
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_GNA,
+                                            {{GNAConfigParams::KEY_GNA_DEVICE_MODE, GNAConfigParams::GNA_SW_FP32},
+                                             {GNAConfigParams::KEY_GNA_LIB_N_THREADS, std::to_string(requestsNum)}});
+    const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+
+    std::vector<InferRequest> requests;
+    std::vector<std::vector<float>> inputs;
+    for (size_t r = 0; r < requestsNum; r++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        std::vector<float> input(inputSize);
+        for (size_t i = 0; i < inputSize; i++) {
+            input[i] = static_cast<float>(static_cast<int>((i + r * 5) % 11) - 5) / 4.f;
+        }
+        inputs.push_back(input);
+    }
+
+    // several runs to catch requests sharing memory of each other
+    for (int run = 0; run < 3; run++) {
+        for (size_t r = 0; r < requestsNum; r++) {
+            auto blob = requests[r].GetBlob(inputName);
+            std::copy(inputs[r].begin(), inputs[r].end(), blob->buffer().as<float*>());
+            requests[r].StartAsync();
+        }
+        for (size_t r = 0; r < requestsNum; r++) {
+            ASSERT_EQ(StatusCode::OK, requests[r].Wait(IInferRequest::WaitMode::RESULT_READY));
+            const auto expected = Reference(inputs[r]);
+            auto actual = requests[r].GetBlob(outputName)->cbuffer().as<const float*>();
+            for (size_t o = 0; o < outputSize; o++) {
+                ASSERT_NEAR(expected[o], actual[o], 1e-4f) << "request " << r << ", output " << o;
+            }
+        }
+    }
+}
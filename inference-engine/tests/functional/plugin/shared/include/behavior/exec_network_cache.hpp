@@ -0,0 +1,136 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpp/ie_cnn_network.h>
+#include <cpp/ie_executable_network.hpp>
+
+#include <common_test_utils/test_constants.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <functional_test_utils/skip_tests_config.hpp>
+
+#include <gtest/gtest.h>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+namespace BehaviorTestsDefinitions {
+
+using ExecNetworkCacheParams = std::tuple<std::string,                          // device name
+                                          std::map<std::string, std::string>>;  // device config
+
+class ExecNetworkCacheTests : public ::testing::TestWithParam<ExecNetworkCacheParams> {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ExecNetworkCacheParams> obj) {
+        std::string deviceName;
+        std::map<std::string, std::string> config;
+        std::tie(deviceName, config) = obj.param;
+        std::ostringstream result;
+        result << "targetDevice=" << deviceName << "_";
+        for (auto& confItem : config) {
+            result << "config=" << confItem.first << ":" << confItem.second << "_";
+        }
+        return result.str();
+    }
+
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        std::tie(deviceName, config) = GetParam();
+        network = InferenceEngine::CNNNetwork(ngraph::builder::subgraph::makeSingleConv({1, 3, 24, 24}));
+        inputName = network.getInputsInfo().begin()->first;
+    }
+
+protected:
+    unsigned int hits() const {
+        return ie.GetMetric({}, METRIC_KEY(EXEC_NETWORK_CACHE_HITS)).as<unsigned int>();
+    }
+
+    unsigned int misses() const {
+        return ie.GetMetric({}, METRIC_KEY(EXEC_NETWORK_CACHE_MISSES)).as<unsigned int>();
+    }
+
+    InferenceEngine::ExecutableNetwork load(const InferenceEngine::SizeVector& shape) {
+        return ie.LoadNetwork(network, {{inputName, shape}}, deviceName, config);
+    }
+
+    static InferenceEngine::SizeVector outputDims(const InferenceEngine::ExecutableNetwork& exeNetwork) {
+        return exeNetwork.GetOutputsInfo().begin()->second->getTensorDesc().getDims();
+    }
+
+    InferenceEngine::Core ie;
+    InferenceEngine::CNNNetwork network;
+    std::string inputName;
+    std::string deviceName;
+    std::map<std::string, std::string> config;
+};
+
+TEST_P(ExecNetworkCacheTests, smoke_ReusesNetworkForSameShapes) {
+    auto first = load({1, 3, 32, 32});
+    EXPECT_EQ(0u, hits());
+    EXPECT_EQ(1u, misses());
+
+    auto second = load({1, 3, 32, 32});
+    EXPECT_EQ(1u, hits());
+    EXPECT_EQ(1u, misses());
+    EXPECT_EQ(InferenceEngine::SizeVector({1, 4, 30, 30}), outputDims(second));
+}
+
+TEST_P(ExecNetworkCacheTests, smoke_ReshapesCopyOfNetworkForNewShapes) {
+    const auto originalShapes = network.getInputShapes();
+
+    auto small = load({1, 3, 16, 16});
+    auto large = load({1, 3, 32, 32});
+    EXPECT_EQ(0u, hits());
+    EXPECT_EQ(2u, misses());
+    EXPECT_EQ(InferenceEngine::SizeVector({1, 4, 14, 14}), outputDims(small));
+    EXPECT_EQ(InferenceEngine::SizeVector({1, 4, 30, 30}), outputDims(large));
+
+    // the passed network is not reshaped, networks loaded with its own shapes are not affected
+    EXPECT_EQ(originalShapes, network.getInputShapes());
+    auto original = load({1, 3, 24, 24});
+    EXPECT_EQ(InferenceEngine::SizeVector({1, 4, 22, 22}), outputDims(original));
+
+    load({1, 3, 16, 16});
+    EXPECT_EQ(1u, hits());
+    EXPECT_EQ(3u, misses());
+}
+
+TEST_P(ExecNetworkCacheTests, smoke_MissesOnChangedPreprocessing) {
+    load({1, 3, 32, 32});
+
+    auto& preProcess = network.getInputsInfo().begin()->second->getPreProcess();
+    preProcess.init(3);
+    preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+    load({1, 3, 32, 32});
+    EXPECT_EQ(2u, misses());
+
+    preProcess[0]->meanValue = 1.f;
+    load({1, 3, 32, 32});
+    EXPECT_EQ(3u, misses());
+
+    preProcess[1]->stdScale = 0.5f;
+    load({1, 3, 32, 32});
+    EXPECT_EQ(4u, misses());
+
+    load({1, 3, 32, 32});
+    EXPECT_EQ(1u, hits());
+    EXPECT_EQ(4u, misses());
+}
+
+TEST_P(ExecNetworkCacheTests, smoke_DropsNetworksOnDeviceSetConfig) {
+    load({1, 3, 32, 32});
+    load({1, 3, 32, 32});
+    EXPECT_EQ(1u, hits());
+
+    ie.SetConfig(config, deviceName);
+    load({1, 3, 32, 32});
+    EXPECT_EQ(1u, hits());
+    EXPECT_EQ(2u, misses());
+}
+
+}  // namespace BehaviorTestsDefinitions
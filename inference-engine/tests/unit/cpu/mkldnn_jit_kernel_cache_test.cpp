@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "utils/jit_kernel_cache.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+struct TestKernel {
+    explicit TestKernel(int param) : param(param) {}
+    int param;
+};
+
+std::shared_ptr<TestKernel> getKernel(int param) {
+    return JitKernelCache::getInstance().getOrCreate<TestKernel>(std::to_string(param),
+        [param]() { return std::make_shared<TestKernel>(param); });
+}
+
+}  // namespace
+
+TEST(JitKernelCacheTest, SameKeyReturnsSameKernel) {
+    auto& cache = JitKernelCache::getInstance();
+    const size_t misses = cache.getMisses();
+    const size_t hits = cache.getHits();
+
+    auto first = getKernel(1);
+    auto second = getKernel(1);
+    auto other = getKernel(2);
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(2, other->param);
+    EXPECT_EQ(misses + 2, cache.getMisses());
+    EXPECT_EQ(hits + 1, cache.getHits());
+}
+
+TEST(JitKernelCacheTest, ReleasedKernelIsCreatedAgain) {
+    auto& cache = JitKernelCache::getInstance();
+    getKernel(3);
+    const size_t misses = cache.getMisses();
+
+    auto kernel = getKernel(3);
+    EXPECT_EQ(misses + 1, cache.getMisses());
+    EXPECT_EQ(3, kernel->param);
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <map>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "utils/numa_utils.h"
+
+TEST(NumaUtilsTest, PlacementCoversResidentMemory) {
+    std::vector<char> buffer(1 << 20);
+    std::memset(buffer.data(), 1, buffer.size());
+
+    std::map<int, uint64_t> placement;
+    if (!MKLDNNPlugin::GetNumaPlacement(buffer.data(), buffer.size(), placement)) {
+        GTEST_SKIP() << "Placement of pages can not be queried on this system";
+    }
+
+    uint64_t total = 0;
+    for (auto& node : placement) {
+        EXPECT_GE(node.first, 0);
+        total += node.second;
+    }
+    EXPECT_EQ(buffer.size(), total);
+}
+
+TEST(NumaUtilsTest, PlacementReportsUnknownMemoryAsNegativeNode) {
+    std::vector<char> buffer(1 << 20);
+
+    std::map<int, uint64_t> placement;
+    bool queried = MKLDNNPlugin::GetNumaPlacement(buffer.data(), buffer.size(), placement);
+
+    uint64_t total = 0;
+    for (auto& node : placement) {
+        EXPECT_GE(node.first, -1);
+        total += node.second;
+    }
+    EXPECT_EQ(buffer.size(), total);
+    if (!queried) {
+        ASSERT_EQ(1u, placement.size());
+        EXPECT_EQ(buffer.size(), placement[-1]);
+    }
+}
+
+TEST(NumaUtilsTest, BindIgnoresInvalidArguments) {
+    std::vector<char> buffer(1 << 20);
+    EXPECT_FALSE(MKLDNNPlugin::BindToNumaNode(nullptr, buffer.size(), 0));
+    EXPECT_FALSE(MKLDNNPlugin::BindToNumaNode(buffer.data(), buffer.size(), -1));
+    EXPECT_FALSE(MKLDNNPlugin::BindToNumaNode(buffer.data(), 1, 0));
+}
+
+TEST(NumaUtilsTest, AllocatedRegionIsPlacedOnNodeAtFirstTouch) {
+    EXPECT_EQ(nullptr, MKLDNNPlugin::AllocateOnNumaNode(0, 0));
+    EXPECT_EQ(nullptr, MKLDNNPlugin::AllocateOnNumaNode(1 << 20, -1));
+
+    const size_t size = 1 << 20;
+    auto region = MKLDNNPlugin::AllocateOnNumaNode(size, 0);
+    if (!region) {
+        GTEST_SKIP() << "Memory policy can not be applied on this system";
+    }
+
+    // pages of the fresh mapping are not resident until they are touched
+    std::map<int, uint64_t> placement;
+    if (!MKLDNNPlugin::GetNumaPlacement(region.get(), size, placement)) {
+        GTEST_SKIP() << "Placement of pages can not be queried on this system";
+    }
+    EXPECT_EQ(size, placement[-1]);
+
+    std::memset(region.get(), 1, size);
+    placement.clear();
+    ASSERT_TRUE(MKLDNNPlugin::GetNumaPlacement(region.get(), size, placement));
+    EXPECT_EQ(size, placement[0]);
+}
@@ -0,0 +1,165 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include "hetero_partitioner.hpp"
+
+using namespace HeteroPlugin;
+
+namespace {
+
+using Affinities = CostModelPartitioner::Affinities;
+using SupportedDevices = CostModelPartitioner::SupportedDevices;
+
+// Convolution 1x64x56x56 -> 1x64x56x56 with 3x3 kernel: 231211008 FLOP, 1753088 bytes including weights.
+// It takes 1156.05504 us on CPU and 289.01376 us on GPU, a transfer of its input or output through GPU takes
+// 100.352 us.
+std::shared_ptr<ngraph::Node> MakeConvolution(const ngraph::Output<ngraph::Node>& input, const std::string& name) {
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{64, 64, 3, 3},
+                                                    std::vector<float>(64 * 64 * 3 * 3, 1.f));
+    auto convolution = std::make_shared<ngraph::opset1::Convolution>(input, weights, ngraph::Strides{1, 1},
+        ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+    convolution->set_friendly_name(name);
+    return convolution;
+}
+
+std::shared_ptr<ngraph::opset1::Parameter> MakeParameter(const ngraph::Shape& shape) {
+    auto parameter = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape);
+    parameter->set_friendly_name("parameter");
+    return parameter;
+}
+
+std::shared_ptr<ngraph::Node> MakeRelu(const ngraph::Output<ngraph::Node>& input, const std::string& name) {
+    auto relu = std::make_shared<ngraph::opset1::Relu>(input);
+    relu->set_friendly_name(name);
+    return relu;
+}
+
+std::shared_ptr<ngraph::Node> MakeResult(const ngraph::Output<ngraph::Node>& input, const std::string& name) {
+    auto result = std::make_shared<ngraph::opset1::Result>(input);
+    result->set_friendly_name(name);
+    return result;
+}
+
+std::vector<std::shared_ptr<ngraph::Node>> GetOrderedOps(const ngraph::ResultVector& results,
+                                                         const ngraph::ParameterVector& parameters) {
+    auto function = std::make_shared<ngraph::Function>(results, parameters);
+    auto orderedOps = function->get_ordered_ops();
+    std::vector<std::shared_ptr<ngraph::Node>> ops;
+    for (auto&& node : orderedOps) {
+        if (!ngraph::op::is_constant(node)) {
+            ops.push_back(node);
+        }
+    }
+    return ops;
+}
+
+Affinities AssignAll(const std::vector<std::shared_ptr<ngraph::Node>>& ops, const std::string& device) {
+    Affinities affinities;
+    for (auto&& node : ops) {
+        affinities[node->get_friendly_name()] = device;
+    }
+    return affinities;
+}
+
+SupportedDevices SupportAll(const std::vector<std::shared_ptr<ngraph::Node>>& ops) {
+    SupportedDevices supported;
+    for (auto&& node : ops) {
+        supported[node->get_friendly_name()] = {"CPU", "GPU"};
+    }
+    return supported;
+}
+
+}  // namespace
+
+TEST(CostModelPartitionerTest, EstimatesComputeTransferAndLaunchOfSingleDevice) {
+    auto parameter = MakeParameter({1, 64, 56, 56});
+    auto result = MakeResult(MakeConvolution(parameter, "conv"), "result");
+    const auto ops = GetOrderedOps({std::dynamic_pointer_cast<ngraph::opset1::Result>(result)}, {parameter});
+    CostModelPartitioner partitioner{ops};
+
+    auto cpu = partitioner.Estimate(AssignAll(ops, "CPU"));
+    EXPECT_NEAR(1156.05504, cpu.computeUs, 1e-6);
+    EXPECT_NEAR(0., cpu.transferUs, 1e-6);
+    EXPECT_NEAR(10., cpu.launchUs, 1e-6);
+    EXPECT_EQ(1, cpu.subgraphs);
+
+    auto gpu = partitioner.Estimate(AssignAll(ops, "GPU"));
+    EXPECT_NEAR(289.01376, gpu.computeUs, 1e-6);
+    EXPECT_NEAR(2 * 100.352, gpu.transferUs, 1e-6);
+    EXPECT_NEAR(100., gpu.launchUs, 1e-6);
+    EXPECT_EQ(1, gpu.subgraphs);
+}
+
+TEST(CostModelPartitionerTest, DataIsPassedToDeviceOnceForSeveralConsumers) {
+    auto parameter = MakeParameter({1, 64, 56, 56});
+    auto convolution = MakeConvolution(parameter, "conv");
+    auto result0 = MakeResult(MakeRelu(convolution, "relu0"), "result0");
+    auto result1 = MakeResult(MakeRelu(convolution, "relu1"), "result1");
+    const auto ops = GetOrderedOps({std::dynamic_pointer_cast<ngraph::opset1::Result>(result0),
+                                    std::dynamic_pointer_cast<ngraph::opset1::Result>(result1)}, {parameter});
+    CostModelPartitioner partitioner{ops};
+
+    auto affinities = AssignAll(ops, "CPU");
+    affinities["parameter"] = "GPU";
+    affinities["conv"] = "GPU";
+    auto cost = partitioner.Estimate(affinities);
+    EXPECT_NEAR(2 * 100.352, cost.transferUs, 1e-6);
+    EXPECT_NEAR(100. + 2 * 10., cost.launchUs, 1e-6);
+    EXPECT_EQ(3, cost.subgraphs);
+}
+
+TEST(CostModelPartitionerTest, OptimizeMovesHeavyNetworkToFasterDevice) {
+    auto parameter = MakeParameter({1, 64, 56, 56});
+    auto result = MakeResult(MakeConvolution(parameter, "conv"), "result");
+    const auto ops = GetOrderedOps({std::dynamic_pointer_cast<ngraph::opset1::Result>(result)}, {parameter});
+    CostModelPartitioner partitioner{ops};
+
+    auto affinities = AssignAll(ops, "CPU");
+    auto cost = partitioner.Optimize(SupportAll(ops), affinities);
+    EXPECT_EQ(AssignAll(ops, "GPU"), affinities);
+    EXPECT_NEAR(289.01376 + 2 * 100.352 + 100., cost.TotalUs(), 1e-6);
+}
+
+TEST(CostModelPartitionerTest, OptimizeMovesLightNetworkToDeviceWithoutTransfers) {
+    auto parameter = MakeParameter({1, 3, 4, 4});
+    auto result = MakeResult(MakeRelu(parameter, "relu"), "result");
+    const auto ops = GetOrderedOps({std::dynamic_pointer_cast<ngraph::opset1::Result>(result)}, {parameter});
+    CostModelPartitioner partitioner{ops};
+
+    auto affinities = AssignAll(ops, "GPU");
+    auto cost = partitioner.Optimize(SupportAll(ops), affinities);
+    EXPECT_EQ(AssignAll(ops, "CPU"), affinities);
+    EXPECT_EQ(1, cost.subgraphs);
+    EXPECT_NEAR(partitioner.Estimate(affinities).TotalUs(), cost.TotalUs(), 1e-6);
+}
+
+TEST(CostModelPartitionerTest, OptimizeSplitsNetworkOnlyOnSupportedDevices) {
+    auto parameter = MakeParameter({1, 64, 56, 56});
+    auto relu = MakeRelu(MakeConvolution(parameter, "conv"), "relu");
+    auto result = MakeResult(relu, "result");
+    const auto ops = GetOrderedOps({std::dynamic_pointer_cast<ngraph::opset1::Result>(result)}, {parameter});
+    CostModelPartitioner partitioner{ops};
+
+    auto supported = SupportAll(ops);
+    supported["relu"] = {"CPU"};
+    supported["result"] = {"CPU"};
+    auto affinities = AssignAll(ops, "CPU");
+    const auto initial = partitioner.Estimate(affinities);
+    auto cost = partitioner.Optimize(supported, affinities);
+
+    // Relu on CPU takes 80.2816 us bounded by memory, the convolution output is passed from GPU once
+    EXPECT_EQ("GPU", affinities["parameter"]);
+    EXPECT_EQ("GPU", affinities["conv"]);
+    EXPECT_EQ("CPU", affinities["relu"]);
+    EXPECT_EQ("CPU", affinities["result"]);
+    EXPECT_EQ(2, cost.subgraphs);
+    EXPECT_NEAR(289.01376 + 80.2816 + 2 * 100.352 + 100. + 10., cost.TotalUs(), 1e-6);
+    EXPECT_LT(cost.TotalUs(), initial.TotalUs());
+}
@@ -47,6 +47,7 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 class I420BlobTests : public CompoundBlobTests {};
+class BatchedBlobTests : public CompoundBlobTests {};
 
 TEST(BlobConversionTests, canWorkWithMemoryBlob) {
     Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
@@ -425,3 +426,43 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
 }
 
 
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromRoisOfOneImage) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 8, 8}, NHWC));
+    image->allocate();
+    Blob::Ptr batched_blob = make_shared_blob(image, std::vector<ROI>{ROI(0, 0, 0, 4, 4), ROI(0, 2, 4, 6, 2)});
+    verifyCompoundBlob(batched_blob);
+    ASSERT_TRUE(batched_blob->is<BatchedBlob>());
+    ASSERT_EQ(2, batched_blob->size());
+
+    auto roi_blob = as<MemoryBlob>(as<BatchedBlob>(batched_blob)->getBlob(1));
+    ASSERT_NE(nullptr, roi_blob);
+    EXPECT_EQ((SizeVector{1, 3, 2, 6}), roi_blob->getTensorDesc().getDims());
+    EXPECT_EQ(image->buffer().as<uint8_t*>(), roi_blob->buffer().as<uint8_t*>());
+}
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromNV12Blobs) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    Blob::Ptr nv12_blob = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    BatchedBlob::Ptr batched_blob = make_shared_blob<BatchedBlob>(BlobPtrs{nv12_blob, nv12_blob});
+    verifyCompoundBlob(batched_blob, {nv12_blob, nv12_blob});
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromDifferentBlobs) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    Blob::Ptr nv12_blob = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    Blob::Ptr u8_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    Blob::Ptr fp32_blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3, 6, 8}, NHWC));
+    Blob::Ptr batch_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 6, 8}, NHWC));
+
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{}), InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{u8_blob, nullptr}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{u8_blob, nv12_blob}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{u8_blob, fp32_blob}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(BlobPtrs{batch_blob}), InferenceEngine::details::InferenceEngineException);
+}
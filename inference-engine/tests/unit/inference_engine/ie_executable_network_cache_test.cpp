@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+
+#include "ie_executable_network_cache.hpp"
+
+#include "unit_test_utils/mocks/mock_iexecutable_network.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class ExecutableNetworkCacheTests : public ::testing::Test {
+protected:
+    std::shared_ptr<int> owner = std::make_shared<int>(0);
+    int loads = 0;
+
+    ExecutableNetworkCache::Loader loader(size_t footprint = 0) {
+        return [this, footprint](size_t& result) {
+            loads++;
+            result = footprint;
+            return ExecutableNetwork(std::make_shared<MockIExecutableNetwork>());
+        };
+    }
+};
+
+TEST_F(ExecutableNetworkCacheTests, ReturnsCachedNetworkOnHit) {
+    ExecutableNetworkCache cache;
+    auto first = cache.getOrLoad("a", owner, loader());
+    auto second = cache.getOrLoad("a", owner, loader());
+
+    ASSERT_EQ(1, loads);
+    ASSERT_EQ(static_cast<IExecutableNetwork::Ptr>(first), static_cast<IExecutableNetwork::Ptr>(second));
+    ASSERT_EQ(1u, cache.getHits());
+    ASSERT_EQ(1u, cache.getMisses());
+}
+
+TEST_F(ExecutableNetworkCacheTests, LoadsNetworkForEachKey) {
+    ExecutableNetworkCache cache;
+    cache.getOrLoad("a", owner, loader());
+    cache.getOrLoad("b", owner, loader());
+
+    ASSERT_EQ(2, loads);
+    ASSERT_EQ(2u, cache.size());
+    ASSERT_EQ(0u, cache.getHits());
+    ASSERT_EQ(2u, cache.getMisses());
+}
+
+TEST_F(ExecutableNetworkCacheTests, EvictsLeastRecentlyUsedNetwork) {
+    ExecutableNetworkCache cache(2);
+    cache.getOrLoad("a", owner, loader());
+    cache.getOrLoad("b", owner, loader());
+    cache.getOrLoad("a", owner, loader());
+    cache.getOrLoad("c", owner, loader());
+
+    ASSERT_EQ(2u, cache.size());
+    ASSERT_EQ(1u, cache.getEvictions());
+
+    cache.getOrLoad("a", owner, loader());
+    ASSERT_EQ(3, loads);
+    cache.getOrLoad("b", owner, loader());
+    ASSERT_EQ(4, loads);
+}
+
+TEST_F(ExecutableNetworkCacheTests, EvictsNetworksToFitMemoryBudget) {
+    ExecutableNetworkCache cache(8, 100);
+    cache.getOrLoad("a", owner, loader(60));
+    cache.getOrLoad("b", owner, loader(60));
+
+    ASSERT_EQ(1u, cache.size());
+    ASSERT_EQ(1u, cache.getEvictions());
+
+    cache.getOrLoad("b", owner, loader(60));
+    ASSERT_EQ(2, loads);
+}
+
+TEST_F(ExecutableNetworkCacheTests, KeepsLastNetworkExceedingMemoryBudget) {
+    ExecutableNetworkCache cache(8, 100);
+    cache.getOrLoad("a", owner, loader(200));
+
+    ASSERT_EQ(1u, cache.size());
+    ASSERT_EQ(0u, cache.getEvictions());
+}
+
+TEST_F(ExecutableNetworkCacheTests, ZeroCapacityDisablesCache) {
+    ExecutableNetworkCache cache(0);
+    cache.getOrLoad("a", owner, loader());
+    cache.getOrLoad("a", owner, loader());
+
+    ASSERT_EQ(2, loads);
+    ASSERT_EQ(0u, cache.size());
+}
+
+TEST_F(ExecutableNetworkCacheTests, ShrinksOnCapacityChange) {
+    ExecutableNetworkCache cache;
+    cache.getOrLoad("a", owner, loader());
+    cache.getOrLoad("b", owner, loader());
+    cache.setCapacity(1);
+
+    ASSERT_EQ(1u, cache.size());
+    cache.getOrLoad("b", owner, loader());
+    ASSERT_EQ(2, loads);
+}
+
+TEST_F(ExecutableNetworkCacheTests, ReloadsNetworkIfOwnerIsDestroyed) {
+    ExecutableNetworkCache cache;
+    cache.getOrLoad("a", owner, loader());
+    owner.reset();
+    auto newOwner = std::make_shared<int>(1);
+    cache.getOrLoad("a", newOwner, loader());
+
+    ASSERT_EQ(2, loads);
+    ASSERT_EQ(2u, cache.getMisses());
+    ASSERT_EQ(1u, cache.size());
+}
+
+TEST_F(ExecutableNetworkCacheTests, DoesNotCacheNetworkIfLoaderThrows) {
+    ExecutableNetworkCache cache;
+    ASSERT_THROW(cache.getOrLoad("a", owner, [](size_t&) -> ExecutableNetwork {
+        THROW_IE_EXCEPTION << "load failed";
+    }), InferenceEngineException);
+
+    ASSERT_EQ(0u, cache.size());
+    cache.getOrLoad("a", owner, loader());
+    ASSERT_EQ(1, loads);
+}
@@ -0,0 +1,213 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <ie_parallel.hpp>
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/concurrent_queue.h>
+#endif
+
+#include "bounded_queue.hpp"
+
+using namespace MultiDevicePlugin;
+
+TEST(BoundedQueueTest, KeepsOrderAndCapacity) {
+    BoundedQueue<int> queue(3);
+    ASSERT_EQ(4, queue.capacity());
+    ASSERT_TRUE(queue.empty());
+
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    int value = 10;
+    ASSERT_FALSE(queue.try_push(value));
+    ASSERT_EQ(10, value);
+
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(ThreadSafeQueueTest, OverflowDoesNotLoseElements) {
+    ThreadSafeQueue<int> queue(2);
+    for (int i = 0; i < 10; i++) {
+        queue.push(i);
+    }
+    std::vector<int> values;
+    int value = 0;
+    while (queue.try_pop(value)) {
+        values.push_back(value);
+    }
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(10, values.size());
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(i, values[i]);
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(ThreadSafeQueueTest, OverflowKeepsOrder) {
+    ThreadSafeQueue<int> queue(4);
+    std::vector<int> values;
+    int value = 0;
+    int next = 0;
+    // pops free cells in the bounded queue while older elements are still in the overflow queue
+    for (int round = 0; round < 5; round++) {
+        for (int i = 0; i < 6; i++) {
+            queue.push(next++);
+        }
+        for (int i = 0; i < 3; i++) {
+            ASSERT_TRUE(queue.try_pop(value));
+            values.push_back(value);
+        }
+    }
+    while (queue.try_pop(value)) {
+        values.push_back(value);
+    }
+    ASSERT_EQ(next, values.size());
+    for (int i = 0; i < next; i++) {
+        ASSERT_EQ(i, values[i]);
+    }
+}
+
+TEST(ThreadSafeQueueTest, ConcurrentProducersAndConsumers) {
+    const int numThreads = 4;
+    const int numItems = 20000;
+    ThreadSafeQueue<int> queue(16);
+    std::atomic<long long> sum{0};
+    std::atomic<int> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&] {
+            for (int i = 1; i <= numItems; i++) {
+                queue.push(i);
+            }
+        });
+        threads.emplace_back([&] {
+            int value = 0;
+            while (popped < numThreads * numItems) {
+                if (queue.try_pop(value)) {
+                    sum += value;
+                    popped++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(static_cast<long long>(numThreads) * numItems * (numItems + 1) / 2, sum.load());
+    ASSERT_TRUE(queue.empty());
+}
+
+namespace {
+
+// Queue used by MULTI before, kept as a baseline for the benchmark
+template <typename T>
+class MutexQueue {
+public:
+    void push(T value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push(std::move(value));
+    }
+
+    bool try_pop(T& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.empty())
+            return false;
+        value = std::move(_queue.front());
+        _queue.pop();
+        return true;
+    }
+
+private:
+    std::queue<T>   _queue;
+    std::mutex      _mutex;
+};
+
+// Mimics queue operations of MULTI for every request: a pipeline task is pushed by run(),
+// the scheduler takes an idle worker and the task, and the worker is returned on completion
+template <template <typename> class Queue>
+double MeasureSchedulingOverheadNs(int numThreads, int requestsPerThread, int numWorkers) {
+    Queue<std::function<void()>> tasks;
+    Queue<int*> idleWorkers;
+    std::vector<int> workers(numWorkers);
+    for (auto& worker : workers) {
+        idleWorkers.push(&worker);
+    }
+
+    std::atomic<int> done{0};
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < requestsPerThread; i++) {
+                tasks.push([&done] { done++; });
+                int* worker = nullptr;
+                while (!idleWorkers.try_pop(worker)) {
+                    std::this_thread::yield();
+                }
+                std::function<void()> task;
+                if (tasks.try_pop(task)) {
+                    task();
+                }
+                idleWorkers.push(worker);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    // Tasks left in the queue are executed here to keep the workload equal
+    std::function<void()> task;
+    while (tasks.try_pop(task)) {
+        task();
+    }
+    EXPECT_EQ(numThreads * requestsPerThread, done.load());
+    return elapsed / (numThreads * requestsPerThread);
+}
+
+template <typename T>
+using LockFreeQueue = ThreadSafeQueue<T>;
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+template <typename T>
+using TbbQueue = tbb::concurrent_queue<T>;
+#endif
+
+}  // namespace
+
+TEST(ThreadSafeQueueTest, DISABLED_SchedulingOverheadBenchmark) {
+    const int requestsPerThread = 20000;
+    const int numWorkers = 8;
+    const int maxThreads = std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        const std::string suffix = "_ns_" + std::to_string(numThreads) + "_threads";
+        RecordProperty("mutex" + suffix,
+                       static_cast<int>(MeasureSchedulingOverheadNs<MutexQueue>(numThreads, requestsPerThread, numWorkers)));
+        RecordProperty("lock_free" + suffix,
+                       static_cast<int>(MeasureSchedulingOverheadNs<LockFreeQueue>(numThreads, requestsPerThread, numWorkers)));
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        RecordProperty("tbb" + suffix,
+                       static_cast<int>(MeasureSchedulingOverheadNs<TbbQueue>(numThreads, requestsPerThread, numWorkers)));
+#endif
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <details/ie_exception.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include "scheduling_policy.hpp"
+
+using namespace MultiDevicePlugin;
+
+namespace {
+
+std::vector<DeviceName> SelectDevices(const std::string& policy, std::vector<DeviceCandidate> candidates) {
+    CreateSchedulingPolicy(policy)->SelectDevices(candidates);
+    std::vector<DeviceName> devices;
+    for (auto&& candidate : candidates) {
+        devices.push_back(candidate.device);
+    }
+    return devices;
+}
+
+}  // namespace
+
+TEST(SchedulingPolicyTest, PriorityPolicyKeepsPriorityOrder) {
+    std::vector<DeviceCandidate> candidates = {
+        {"GPU", 0, 4, 4, 10.0},
+        {"CPU", 1, 2, 0, 1.0},
+    };
+    ASSERT_EQ((std::vector<DeviceName>{"GPU", "CPU"}), SelectDevices(MULTI_CONFIG_VALUE(PRIORITY), candidates));
+}
+
+TEST(SchedulingPolicyTest, EarliestCompletionPrefersFasterIdleDevice) {
+    std::vector<DeviceCandidate> candidates = {
+        {"GPU", 0, 4, 0, 10.0},
+        {"CPU", 1, 2, 0, 5.0},
+    };
+    ASSERT_EQ((std::vector<DeviceName>{"CPU", "GPU"}), SelectDevices(MULTI_CONFIG_VALUE(EARLIEST_COMPLETION), candidates));
+}
+
+TEST(SchedulingPolicyTest, EarliestCompletionWaitsForBusyDeviceWhichCompletesEarlier) {
+    // busy GPU gets free after 1 + 1 / 4 ms, that is earlier than 20 ms on the idle CPU
+    std::vector<DeviceCandidate> candidates = {
+        {"CPU", 0, 2, 0, 20.0},
+        {"GPU", 1, 4, 4, 1.0},
+    };
+    ASSERT_TRUE(SelectDevices(MULTI_CONFIG_VALUE(EARLIEST_COMPLETION), candidates).empty());
+}
+
+TEST(SchedulingPolicyTest, EarliestCompletionTriesUnmeasuredIdleDevicesFirst) {
+    std::vector<DeviceCandidate> candidates = {
+        {"GPU", 0, 4, 0, 1.0},
+        {"CPU", 1, 2, 0, 0.0},
+        {"MYRIAD", 2, 4, 0, 0.0},
+    };
+    ASSERT_EQ((std::vector<DeviceName>{"CPU", "MYRIAD", "GPU"}),
+              SelectDevices(MULTI_CONFIG_VALUE(EARLIEST_COMPLETION), candidates));
+}
+
+TEST(SchedulingPolicyTest, EarliestCompletionDoesNotWaitForUnmeasuredBusyDevice) {
+    // busy device without measurements must not hide idle ones
+    std::vector<DeviceCandidate> candidates = {
+        {"GPU", 0, 4, 4, 0.0},
+        {"CPU", 1, 2, 0, 5.0},
+        {"MYRIAD", 2, 4, 1, 0.0},
+    };
+    ASSERT_EQ((std::vector<DeviceName>{"MYRIAD", "CPU"}),
+              SelectDevices(MULTI_CONFIG_VALUE(EARLIEST_COMPLETION), candidates));
+}
+
+TEST(SchedulingPolicyTest, EarliestCompletionWaitsWhenAllDevicesAreBusy) {
+    std::vector<DeviceCandidate> candidates = {
+        {"GPU", 0, 4, 4, 0.0},
+        {"CPU", 1, 2, 2, 5.0},
+    };
+    ASSERT_TRUE(SelectDevices(MULTI_CONFIG_VALUE(EARLIEST_COMPLETION), candidates).empty());
+}
+
+TEST(SchedulingPolicyTest, ThroughputProportionalPrefersLessLoadedDevice) {
+    // relative loads: GPU (2 + 1) * 4 / 4 = 3, CPU (0 + 1) * 4 / 2 = 2
+    std::vector<DeviceCandidate> candidates = {
+        {"GPU", 0, 4, 2, 4.0},
+        {"CPU", 1, 2, 0, 4.0},
+    };
+    ASSERT_EQ((std::vector<DeviceName>{"CPU", "GPU"}), SelectDevices(MULTI_CONFIG_VALUE(THROUGHPUT_PROPORTIONAL), candidates));
+}
+
+TEST(SchedulingPolicyTest, ThrowsOnUnknownPolicy) {
+    ASSERT_THROW(CreateSchedulingPolicy("UNKNOWN"), InferenceEngine::details::InferenceEngineException);
+}
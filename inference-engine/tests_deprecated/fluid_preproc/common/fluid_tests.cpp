@@ -15,13 +15,16 @@
 #include <opencv2/gapi.hpp>
 #include <opencv2/gapi/imgproc.hpp>
 
+#include <cmath>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
 #include <chrono>
 
 #include <map>
+#include <thread>
 
 #include <fluid_test_computations.hpp>
 
@@ -1185,3 +1188,350 @@ TEST_P(PreprocTest, Performance)
 #endif // PERF_TEST
 
 }
+
+TEST(PreprocCacheTest, ReusesGraphsForMultiplexedResolutions)
+{
+    using namespace InferenceEngine;
+    const std::vector<cv::Size> in_sizes = { cv::Size(1920, 1080), cv::Size(1280, 720), cv::Size(640, 480) };
+    const cv::Size out_size(300, 300);
+
+    cv::Mat out_mat(out_size, CV_8UC3);
+    cv::Mat out_mat_ocv;
+    auto out_blob = img2Blob<Precision::U8>(out_mat, Layout::NCHW);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    // every pre-processing object stands for an infer request of one network sharing the streams
+    const int network = 0;
+    std::vector<PreProcessDataPtr> requests = { CreatePreprocDataHelper(), CreatePreprocDataHelper() };
+    for (auto& request : requests) {
+        request->setCacheOwner(&network);
+    }
+    std::vector<cv::Mat> frames;
+    for (const auto& size : in_sizes) {
+        frames.emplace_back(size, CV_8UC3);
+        cv::randu(frames.back(), cv::Scalar::all(0), cv::Scalar::all(255));
+    }
+
+    size_t hits = 0, misses = 0;
+    auto run = [&](size_t iterations) {
+        for (size_t i = 0; i < iterations; i++) {
+            auto& frame = frames[i % frames.size()];
+            auto& preprocess = requests[i % requests.size()];
+            preprocess->setRoiBlob(img2Blob<Precision::U8>(frame, Layout::NHWC));
+            preprocess->execute(out_blob, info, false);
+
+            Blob2Img<Precision::U8>(out_blob, out_mat, Layout::NCHW);
+            cv::resize(frame, out_mat_ocv, out_size, 0, 0, cv::INTER_LINEAR);
+            EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), 1);
+        }
+    };
+
+    // warm-up compiles a graph per resolution
+    run(frames.size() * requests.size());
+    requests[0]->getCacheStatistics(hits, misses);
+    EXPECT_EQ(frames.size(), misses);
+    const auto warm_hits = hits;
+
+    run(4 * frames.size() * requests.size());
+    requests[1]->getCacheStatistics(hits, misses);
+    EXPECT_EQ(frames.size(), misses);
+    EXPECT_EQ(warm_hits + 4 * frames.size() * requests.size(), hits);
+}
+
+TEST(PreprocCacheTest, KeepsSeparateCachePerOwner)
+{
+    using namespace InferenceEngine;
+    cv::Mat in_mat(cv::Size(640, 480), CV_8UC3);
+    cv::randu(in_mat, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::Mat out_mat(cv::Size(300, 300), CV_8UC3);
+    auto out_blob = img2Blob<Precision::U8>(out_mat, Layout::NCHW);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    // pre-processing objects of two networks
+    const int networks[2] = {};
+    std::vector<PreProcessDataPtr> requests = { CreatePreprocDataHelper(), CreatePreprocDataHelper() };
+    for (size_t i = 0; i < requests.size(); i++) {
+        requests[i]->setCacheOwner(&networks[i]);
+        requests[i]->setRoiBlob(img2Blob<Precision::U8>(in_mat, Layout::NHWC));
+        requests[i]->execute(out_blob, info, false);
+        requests[i]->execute(out_blob, info, false);
+    }
+
+    for (auto& request : requests) {
+        size_t hits = 0, misses = 0;
+        request->getCacheStatistics(hits, misses);
+        EXPECT_EQ(1u, misses);
+        EXPECT_EQ(1u, hits);
+    }
+}
+
+TEST(PreprocCacheTest, ConcurrentCallsKeepGraphPerUser)
+{
+    using namespace InferenceEngine;
+    constexpr size_t users = 2, iterations = 16;
+    cv::Mat in_mat(cv::Size(640, 480), CV_8UC3);
+    cv::randu(in_mat, cv::Scalar::all(0), cv::Scalar::all(255));
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    const int network = 0;
+    std::vector<PreProcessDataPtr> requests;
+    std::vector<cv::Mat> out_mats;
+    for (size_t i = 0; i < users; i++) {
+        requests.push_back(CreatePreprocDataHelper());
+        requests.back()->setCacheOwner(&network);
+        requests.back()->setRoiBlob(img2Blob<Precision::U8>(in_mat, Layout::NHWC));
+        out_mats.emplace_back(cv::Size(300, 300), CV_8UC3);
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < users; i++) {
+        threads.emplace_back([&, i] {
+            auto out_blob = img2Blob<Precision::U8>(out_mats[i], Layout::NCHW);
+            for (size_t j = 0; j < iterations; j++) {
+                requests[i]->execute(out_blob, info, true);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // every concurrent user compiles a graph once at most, then graphs are reused
+    size_t hits = 0, misses = 0;
+    requests[0]->getCacheStatistics(hits, misses);
+    EXPECT_LE(misses, users);
+    EXPECT_EQ(users * iterations, hits + misses);
+}
+
+TEST(PreprocLetterboxTest, NearestKeepsAspectRatioAndPads)
+{
+    using namespace InferenceEngine;
+    const cv::Size in_size(640, 320);
+    const cv::Size out_size(320, 320);
+    const float pad_value = 114.f;
+
+    cv::Mat in_mat(in_size, CV_8UC3);
+    cv::randu(in_mat, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::Mat out_mat(out_size, CV_8UC3);
+
+    auto in_blob = img2Blob<Precision::U8>(in_mat, Layout::NHWC);
+    auto out_blob = img2Blob<Precision::U8>(out_mat, Layout::NCHW);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_NEAREST);
+    info.setLetterbox(true, pad_value);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+    preprocess->execute(out_blob, info, false);
+    Blob2Img<Precision::U8>(out_blob, out_mat, Layout::NCHW);
+
+    const auto transform = PreProcessInfo::getLetterboxTransform(in_size.width, in_size.height,
+                                                                 out_size.width, out_size.height);
+    EXPECT_EQ(0.5f, transform.scale);
+    EXPECT_EQ(0u, transform.offsetX);
+    EXPECT_EQ(80u, transform.offsetY);
+    EXPECT_EQ(320u, transform.width);
+    EXPECT_EQ(160u, transform.height);
+
+    const cv::Rect image_rect(transform.offsetX, transform.offsetY, transform.width, transform.height);
+    cv::Mat out_mat_ocv;
+    cv::resize(in_mat, out_mat_ocv, image_rect.size(), 0, 0, cv::INTER_NEAREST);
+    EXPECT_EQ(0, cv::norm(out_mat_ocv, out_mat(image_rect), cv::NORM_INF));
+
+    const cv::Mat pad(1, 1, CV_8UC3, cv::Scalar::all(pad_value));
+    const cv::Rect top(0, 0, out_size.width, image_rect.y);
+    const cv::Rect bottom(0, image_rect.y + image_rect.height, out_size.width, out_size.height - image_rect.br().y);
+    for (const auto& rect : { top, bottom }) {
+        cv::Mat expected;
+        cv::repeat(pad, rect.height, rect.width, expected);
+        EXPECT_EQ(0, cv::norm(expected, out_mat(rect), cv::NORM_INF));
+    }
+}
+
+TEST(PreprocBicubicTest, MatchesOpenCV)
+{
+    using namespace InferenceEngine;
+    for (const auto& sizes : { std::make_pair(cv::Size(640, 480), cv::Size(300, 300)),
+                               std::make_pair(cv::Size(100, 60), cv::Size(227, 227)) }) {
+        cv::Mat in_mat(sizes.first, CV_32FC3);
+        cv::randu(in_mat, cv::Scalar::all(0), cv::Scalar::all(255));
+        cv::Mat out_mat(sizes.second, CV_32FC3);
+
+        auto in_blob = img2Blob<Precision::FP32>(in_mat, Layout::NCHW);
+        auto out_blob = img2Blob<Precision::FP32>(out_mat, Layout::NCHW);
+
+        PreProcessInfo info;
+        info.setResizeAlgorithm(RESIZE_BICUBIC);
+
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(in_blob);
+        preprocess->execute(out_blob, info, false);
+        Blob2Img<Precision::FP32>(out_blob, out_mat, Layout::NCHW);
+
+        cv::Mat out_mat_ocv;
+        cv::resize(in_mat, out_mat_ocv, sizes.second, 0, 0, cv::INTER_CUBIC);
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), 0.01);
+    }
+}
+
+TEST(PreprocBatchedBlobTest, ResizesRoisOfOneFrameIntoBatchItems)
+{
+    using namespace InferenceEngine;
+    const cv::Size in_size(640, 480);
+    const cv::Size out_size(64, 64);
+    const std::vector<cv::Rect> rois = { cv::Rect(0, 0, 320, 240), cv::Rect(100, 50, 37, 91), cv::Rect(400, 300, 240, 180) };
+    const auto batch = rois.size() + 1;
+
+    cv::Mat in_mat(in_size, CV_8UC3);
+    cv::randu(in_mat, cv::Scalar::all(0), cv::Scalar::all(255));
+    auto in_blob = img2Blob<Precision::U8>(in_mat, Layout::NHWC);
+
+    auto out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {batch, 3, (size_t)out_size.height,
+                                                                          (size_t)out_size.width}, Layout::NCHW));
+    out_blob->allocate();
+    std::fill_n(out_blob->buffer().as<uint8_t*>(), out_blob->size(), 0);
+
+    std::vector<ROI> ie_rois;
+    for (const auto& roi : rois) {
+        ie_rois.emplace_back(0, roi.x, roi.y, roi.width, roi.height);
+    }
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(make_shared_blob(in_blob, ie_rois));
+    Blob::Ptr out = out_blob;
+    preprocess->execute(out, info, false);
+
+    const auto item_size = 3 * out_size.area();
+    for (size_t i = 0; i < batch; i++) {
+        auto item_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, (size_t)out_size.height,
+                                                                               (size_t)out_size.width}, Layout::NCHW),
+                                                   out_blob->buffer().as<uint8_t*>() + i * item_size);
+        cv::Mat out_mat(out_size, CV_8UC3);
+        Blob2Img<Precision::U8>(item_blob, out_mat, Layout::NCHW);
+
+        // batch items without ROIs are not touched
+        cv::Mat out_mat_ocv = cv::Mat::zeros(out_size, CV_8UC3);
+        if (i < rois.size()) {
+            cv::resize(in_mat(rois[i]), out_mat_ocv, out_size, 0, 0, cv::INTER_LINEAR);
+        }
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), 1) << "batch item " << i;
+    }
+}
+
+TEST(PreprocNormalizeTest, ResizesAndNormalizesIntoPlanarFloat)
+{
+    using namespace InferenceEngine;
+    const cv::Size in_size(640, 480);
+    const cv::Size out_size(300, 300);
+    const float mean[] = { 10.f, 20.f, 30.f };
+    const float scale[] = { 0.5f, 0.25f, 2.f };
+
+    cv::Mat in_mat(in_size, CV_8UC3);
+    cv::randu(in_mat, cv::Scalar::all(0), cv::Scalar::all(255));
+    auto in_blob = img2Blob<Precision::U8>(in_mat, Layout::NHWC);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    info.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        info[c]->meanValue = mean[c];
+        info[c]->stdScale = scale[c];
+    }
+    info.setVariant(MEAN_VALUE);
+
+    // reference is OpenCV resize of 8U image followed by normalization in floating point
+    cv::Mat resized;
+    cv::resize(in_mat, resized, out_size, 0, 0, cv::INTER_LINEAR);
+    std::vector<cv::Mat> ref_planes;
+    cv::split(resized, ref_planes);
+    for (size_t c = 0; c < 3; c++) {
+        ref_planes[c].convertTo(ref_planes[c], CV_32F, scale[c], -mean[c] * scale[c]);
+    }
+
+    const SizeVector out_dims = { 1, 3, (size_t)out_size.height, (size_t)out_size.width };
+    const size_t plane_size = out_size.area();
+
+    // FP32 output differs from reference by rounding of resize only, at most 1 unit before scaling
+    {
+        auto out_blob = make_shared_blob<float>(TensorDesc(Precision::FP32, out_dims, Layout::NCHW));
+        out_blob->allocate();
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(in_blob);
+        Blob::Ptr out = out_blob;
+        preprocess->execute(out, info, false);
+
+        for (size_t c = 0; c < 3; c++) {
+            cv::Mat plane(out_size, CV_32FC1, out_blob->buffer().as<float*>() + c * plane_size);
+            EXPECT_LE(cv::norm(ref_planes[c], plane, cv::NORM_INF), scale[c]) << "channel " << c;
+        }
+    }
+
+    // BF16 keeps 8 bits of mantissa, so relative error of rounding is added
+    {
+        auto out_blob = make_shared_blob<int16_t>(TensorDesc(Precision::BF16, out_dims, Layout::NCHW));
+        out_blob->allocate();
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(in_blob);
+        Blob::Ptr out = out_blob;
+        preprocess->execute(out, info, false);
+
+        const auto* data = out_blob->buffer().as<uint16_t*>();
+        for (size_t c = 0; c < 3; c++) {
+            const auto* ref = ref_planes[c].ptr<float>();
+            for (size_t i = 0; i < plane_size; i++) {
+                const uint32_t bits = static_cast<uint32_t>(data[c * plane_size + i]) << 16;
+                float value = 0.f;
+                std::memcpy(&value, &bits, sizeof(value));
+                ASSERT_LE(std::fabs(ref[i] - value), scale[c] + std::fabs(ref[i]) / 256)
+                    << "channel " << c << " pixel " << i;
+            }
+        }
+    }
+}
+
+TEST(PreprocNormalizeTest, ConvertsNV12IntoPlanarFloatWithoutNormalization)
+{
+    using namespace InferenceEngine;
+    const cv::Size in_size(640, 480);
+    const cv::Size out_size(224, 224);
+
+    cv::Mat in_mat_y(in_size, CV_8UC1);
+    cv::Mat in_mat_uv(in_size / 2, CV_8UC2);
+    cv::randu(in_mat_y, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::randu(in_mat_uv, cv::Scalar::all(0), cv::Scalar::all(255));
+    auto y_blob = img2Blob<Precision::U8>(in_mat_y, Layout::NHWC);
+    auto uv_blob = img2Blob<Precision::U8>(in_mat_uv, Layout::NHWC);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    info.setColorFormat(ColorFormat::NV12);
+
+    // 8U pipeline of G-API is the reference, converted planes must match it exactly
+    cv::Mat out_mat(out_size, CV_8UC3);
+    auto out_blob_u8 = img2Blob<Precision::U8>(out_mat, Layout::NCHW);
+    auto out_blob_f32 = make_shared_blob<float>(TensorDesc(Precision::FP32, out_blob_u8->getTensorDesc().getDims(),
+                                                           Layout::NCHW));
+    out_blob_f32->allocate();
+
+    for (auto& out_blob : std::vector<Blob::Ptr>{ out_blob_u8, out_blob_f32 }) {
+        PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+        preprocess->setRoiBlob(make_shared_blob<NV12Blob>(y_blob, uv_blob));
+        preprocess->execute(out_blob, info, false);
+    }
+
+    const auto* u8 = out_blob_u8->buffer().as<uint8_t*>();
+    const auto* f32 = out_blob_f32->buffer().as<float*>();
+    for (size_t i = 0; i < out_blob_u8->size(); i++) {
+        ASSERT_EQ(static_cast<float>(u8[i]), f32[i]) << "element " << i;
+    }
+}
@@ -458,3 +458,36 @@ TEST_F(I16QuantisationTest, SplitToConcatWith2Inputs1360NotAlignedNoFC) {
             .propagate_forward()
             .called();
 }
+
+TEST_F(I16QuantisationTest, quantizeAffine16OfLargeMatrixMatchesElementwiseQuantization) {
+    // large enough to be quantized by several threads
+    const uint32_t rows = 1024, columns = 300, columnsPadded = 304;
+    std::vector<float> weights(rows * columns);
+    std::vector<float> biases(rows);
+    for (uint32_t i = 0; i != weights.size(); i++) {
+        weights[i] = static_cast<float>(static_cast<int>(i % 2001) - 1000) / 100.f;
+    }
+    for (uint32_t i = 0; i != rows; i++) {
+        biases[i] = static_cast<float>(i) / 10.f;
+    }
+    std::vector<int16_t> intWeights(rows * columnsPadded, 1);
+    std::vector<int32_t> intBiases(rows);
+    float weightsScale = 1.0f, outputScale = 1.0f;
+
+    QuantizeAffine16(weights.data(), biases.data(), intWeights.data(), intBiases.data(), 2.0f,
+                     &weightsScale, &outputScale, rows, columns, rows, columnsPadded);
+
+    ASSERT_FLOAT_EQ(weightsScale, MAX_VAL_2B_WEIGHT / 10.f);
+    ASSERT_FLOAT_EQ(outputScale, 2.0f * weightsScale);
+    for (uint32_t row = 0; row != rows; row++) {
+        for (uint32_t col = 0; col != columnsPadded; col++) {
+            int16_t expected = 0;
+            if (col < columns) {
+                auto w = weights[row * columns + col];
+                expected = static_cast<int16_t>(w * weightsScale + (w > 0 ? 0.5f : -0.5f));
+            }
+            ASSERT_EQ(expected, intWeights[row * columnsPadded + col]) << "row " << row << ", col " << col;
+        }
+        ASSERT_EQ(static_cast<int32_t>(biases[row] * outputScale + (biases[row] > 0 ? 0.5f : -0.5f)), intBiases[row]);
+    }
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -33,6 +34,10 @@ namespace ngraph
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
 
+            /// \brief Constructs a model which shares ownership of the model proto, so data of
+            ///        its initializers can be referenced by Constant nodes without copying.
+            explicit Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto);
+
             Model(const Model&) = default;
             Model(Model&&) = default;
 
@@ -41,6 +46,12 @@ namespace ngraph
 
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
+            /// \brief Returns the model proto if its ownership is shared with the model,
+            ///        nullptr otherwise.
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_shared_model_proto() const
+            {
+                return m_shared_model_proto;
+            }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
             const std::string& get_producer_version() const
             {
@@ -74,6 +85,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_shared_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -23,6 +24,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "onnx_import/utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -151,12 +153,21 @@ namespace ngraph
                         }
 
                         template <typename T>
-                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                        inline std::vector<T> __get_raw_data(const char* raw_data,
+                                                             std::size_t raw_data_size,
                                                              int onnx_data_type)
                         {
-                            auto it = reinterpret_cast<const T*>(raw_data.data());
+                            auto it = reinterpret_cast<const T*>(raw_data);
                             return std::vector<T>(
-                                it, it + (raw_data.size() / __get_onnx_data_size(onnx_data_type)));
+                                it, it + (raw_data_size / __get_onnx_data_size(onnx_data_type)));
+                        }
+
+                        template <typename T>
+                        inline std::vector<T> __get_raw_data(const std::string& raw_data,
+                                                             int onnx_data_type)
+                        {
+                            return __get_raw_data<T>(
+                                raw_data.data(), raw_data.size(), onnx_data_type);
                         }
                     }
                 }
@@ -403,8 +414,17 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+
+            /// \brief      Constructs a tensor.
+            ///
+            /// \param[in]  tensor       The tensor protobuf representation object.
+            /// \param[in]  model_proto  The model which contains the tensor. When given, raw data
+            ///                          of the tensor is shared with Constant nodes and the model
+            ///                          is kept alive by them instead of copying the data.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
                 : m_tensor_proto{&tensor}
+                , m_model_proto{std::move(model_proto)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -430,6 +450,13 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (detail::has_external_data(*m_tensor_proto))
+                {
+                    const auto buffer =
+                        detail::TensorExternalData{*m_tensor_proto}.load_external_data();
+                    return detail::tensor::detail::__get_raw_data<T>(
+                        buffer->get_ptr<char>(), buffer->size(), m_tensor_proto->data_type());
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -526,8 +553,37 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                const auto byte_size = shape_size(m_shape) * type.size();
+                if (detail::has_external_data(*m_tensor_proto))
+                {
+                    // Mapped pages of the external data file are loaded on first access
+                    detail::TensorExternalData external_data{*m_tensor_proto};
+                    auto buffer = external_data.load_external_data();
+                    if (buffer->size() != byte_size)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            external_data,
+                            "Expected " + std::to_string(byte_size) + " bytes of data, got " +
+                                std::to_string(buffer->size())};
+                    }
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                }
+                else if (m_model_proto && m_tensor_proto->has_raw_data() &&
+                         m_tensor_proto->raw_data().size() == byte_size && byte_size != 0)
+                {
+                    // raw_data is referenced in place and the model is kept alive by the constant
+                    auto buffer = std::make_shared<detail::SharedDataBuffer>(
+                        const_cast<char*>(m_tensor_proto->raw_data().data()),
+                        byte_size,
+                        m_model_proto);
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                }
+                else
+                {
+                    constant =
+                        std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -536,6 +592,7 @@ namespace ngraph
             }
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
             Shape m_shape;
         };
 
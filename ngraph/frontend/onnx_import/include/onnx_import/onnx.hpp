@@ -68,6 +68,22 @@ namespace ngraph
         ONNX_IMPORTER_API
         std::shared_ptr<Function> import_onnx_model(std::istream& stream);
 
+        /// \brief      Imports and converts an serialized ONNX model from the input stream
+        ///             to an nGraph Function representation.
+        ///
+        /// \note       If stream parsing fails or the ONNX model contains unsupported ops,
+        ///             the function throws an ngraph_error exception.
+        ///
+        /// \param[in]  stream      The input stream (e.g. file stream, memory stream, etc).
+        /// \param[in]  model_path  The path to the model file. Locations of tensor data stored
+        ///                         outside the model (external data) are relative to the
+        ///                         directory of this file.
+        ///
+        /// \return     An nGraph function that represents a single output from the created graph.
+        ONNX_IMPORTER_API
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path);
+
         /// \brief     Imports and converts an ONNX model from the input file
         ///            to an nGraph Function representation.
         ///
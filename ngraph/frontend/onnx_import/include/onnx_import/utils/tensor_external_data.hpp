@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            /// \brief Buffer which references memory of an object kept alive by the buffer,
+            ///        e.g. raw_data of the model proto or a mapped region of a file
+            using SharedDataBuffer = runtime::SharedBuffer<std::shared_ptr<const void>>;
+
+            /// \brief      Helper class used to load tensor data stored outside the model
+            ///             file (data_location=EXTERNAL).
+            class TensorExternalData
+            {
+            public:
+                explicit TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
+
+                /// \brief      Maps the part of the external data file with tensor data
+                ///             into memory without reading it.
+                ///
+                /// \note       Pages are mapped copy-on-write, so changes of the data
+                ///             never reach the file.
+                ///
+                /// \return     Buffer referencing the mapped memory, the file is unmapped
+                ///             when the buffer is destroyed.
+                std::shared_ptr<SharedDataBuffer> load_external_data() const;
+
+                /// \brief      Represents parameters of the external data as a string.
+                std::string to_string() const;
+
+            private:
+                std::string m_data_location;
+                std::size_t m_offset{0};
+                // 0 means data up to the end of the file
+                std::size_t m_data_length{0};
+            };
+
+            /// \brief      Checks whether tensor data is stored outside the model file.
+            inline bool has_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                return tensor.has_data_location() &&
+                       tensor.data_location() == ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL;
+            }
+
+            /// \brief      Makes locations of all external data in the model relative to
+            ///             the directory of the model file, as required by ONNX.
+            ///
+            /// \param[in]  model_proto  The model which external data locations are updated.
+            /// \param[in]  model_path   The path to the model file.
+            void update_external_data_paths(ONNX_NAMESPACE::ModelProto& model_proto,
+                                            const std::string& model_path);
+        } // namespace detail
+
+        namespace error
+        {
+            namespace tensor
+            {
+                struct invalid_external_data : ngraph_error
+                {
+                    explicit invalid_external_data(const detail::TensorExternalData& external_data)
+                        : ngraph_error{"invalid external data: " + external_data.to_string()}
+                    {
+                    }
+
+                    invalid_external_data(const detail::TensorExternalData& external_data,
+                                          const std::string& reason)
+                        : ngraph_error{"invalid external data: " + external_data.to_string() +
+                                       ". " + reason}
+                    {
+                    }
+                };
+            } // namespace tensor
+        }     // namespace error
+    }         // namespace onnx_import
+} // namespace ngraph
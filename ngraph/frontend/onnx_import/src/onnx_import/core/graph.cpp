@@ -85,7 +85,7 @@ namespace ngraph
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
+                    Tensor tensor = Tensor{initializer_tensor, m_model->get_shared_model_proto()};
                     initializers.emplace(initializer_tensor.name(), tensor);
 
                     // For each initializer create a Constant node and store it in cache
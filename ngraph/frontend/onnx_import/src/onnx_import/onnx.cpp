@@ -24,6 +24,7 @@
 #include "onnx_import/core/model.hpp"
 #include "onnx_import/onnx.hpp"
 #include "onnx_import/ops_bridge.hpp"
+#include "onnx_import/utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -73,11 +74,11 @@ namespace ngraph
 
             } // namespace error
 
-            std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+            std::shared_ptr<Function> convert_to_ng_function(
+                std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto)
             {
                 Model model{model_proto};
-                Graph graph{model_proto.graph(), model};
+                Graph graph{model_proto->graph(), model};
                 auto function = std::make_shared<Function>(
                     graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
                 for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -90,6 +91,12 @@ namespace ngraph
         } // namespace detail
 
         std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            return import_onnx_model(stream, "");
+        }
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path)
         {
             if (!stream.good())
             {
@@ -101,9 +108,10 @@ namespace ngraph
                 }
             }
 
-            ONNX_NAMESPACE::ModelProto model_proto;
+            // The model is shared with Constant nodes which reference data of its initializers
+            auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
             // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            if (!model_proto->ParseFromIstream(&stream))
             {
 #ifdef NGRAPH_USE_PROTOBUF_LITE
                 throw detail::error::stream_parse_binary();
@@ -113,12 +121,13 @@ namespace ngraph
                 stream.seekg(0);
                 google::protobuf::io::IstreamInputStream iistream(&stream);
                 // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                if (!google::protobuf::TextFormat::Parse(&iistream, model_proto.get()))
                 {
                     throw detail::error::stream_parse_text();
                 }
 #endif
             }
+            detail::update_external_data_paths(*model_proto, model_path);
             return detail::convert_to_ng_function(model_proto);
         }
 
@@ -129,7 +138,7 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            return import_onnx_model(ifs, file_path);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
@@ -0,0 +1,337 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#include "ngraph/file_util.hpp"
+#include "onnx_import/utils/tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            namespace
+            {
+                /// \brief Region of a file mapped into memory, unmapped on destruction.
+                class MappedFileRegion
+                {
+                public:
+                    MappedFileRegion(const MappedFileRegion&) = delete;
+                    MappedFileRegion& operator=(const MappedFileRegion&) = delete;
+
+#ifdef _WIN32
+                    MappedFileRegion(const TensorExternalData& external_data,
+                                     const std::string& path,
+                                     std::size_t offset,
+                                     std::size_t length)
+                    {
+                        HANDLE file = CreateFileA(path.c_str(),
+                                                  GENERIC_READ,
+                                                  FILE_SHARE_READ,
+                                                  nullptr,
+                                                  OPEN_EXISTING,
+                                                  FILE_ATTRIBUTE_NORMAL,
+                                                  nullptr);
+                        if (file == INVALID_HANDLE_VALUE)
+                        {
+                            throw error::tensor::invalid_external_data{external_data,
+                                                                       "Cannot open the file"};
+                        }
+                        LARGE_INTEGER file_size;
+                        if (!GetFileSizeEx(file, &file_size))
+                        {
+                            CloseHandle(file);
+                            throw error::tensor::invalid_external_data{
+                                external_data, "Cannot get size of the file"};
+                        }
+                        m_length = check_length(external_data,
+                                                static_cast<std::size_t>(file_size.QuadPart),
+                                                offset,
+                                                length);
+                        if (m_length == 0)
+                        {
+                            CloseHandle(file);
+                            return;
+                        }
+
+                        SYSTEM_INFO system_info;
+                        GetSystemInfo(&system_info);
+                        const std::size_t granularity = system_info.dwAllocationGranularity;
+                        const std::size_t aligned_offset = offset - offset % granularity;
+
+                        m_mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                        CloseHandle(file);
+                        if (m_mapping == nullptr)
+                        {
+                            throw error::tensor::invalid_external_data{external_data,
+                                                                       "Cannot map the file"};
+                        }
+                        const auto offset64 = static_cast<unsigned long long>(aligned_offset);
+                        m_view = MapViewOfFile(m_mapping,
+                                               FILE_MAP_COPY,
+                                               static_cast<DWORD>(offset64 >> 32),
+                                               static_cast<DWORD>(offset64 & 0xFFFFFFFF),
+                                               m_length + (offset - aligned_offset));
+                        if (m_view == nullptr)
+                        {
+                            CloseHandle(m_mapping);
+                            throw error::tensor::invalid_external_data{external_data,
+                                                                       "Cannot map the file"};
+                        }
+                        m_data = static_cast<char*>(m_view) + (offset - aligned_offset);
+                    }
+
+                    ~MappedFileRegion()
+                    {
+                        if (m_view != nullptr)
+                        {
+                            UnmapViewOfFile(m_view);
+                        }
+                        if (m_mapping != nullptr)
+                        {
+                            CloseHandle(m_mapping);
+                        }
+                    }
+#else
+                    MappedFileRegion(const TensorExternalData& external_data,
+                                     const std::string& path,
+                                     std::size_t offset,
+                                     std::size_t length)
+                    {
+                        int fd = open(path.c_str(), O_RDONLY);
+                        if (fd == -1)
+                        {
+                            throw error::tensor::invalid_external_data{
+                                external_data,
+                                std::string{"Cannot open the file: "} + std::strerror(errno)};
+                        }
+                        struct stat file_stat = {};
+                        if (fstat(fd, &file_stat) == -1)
+                        {
+                            close(fd);
+                            throw error::tensor::invalid_external_data{
+                                external_data,
+                                std::string{"Cannot get size of the file: "} +
+                                    std::strerror(errno)};
+                        }
+                        try
+                        {
+                            m_length = check_length(external_data,
+                                                    static_cast<std::size_t>(file_stat.st_size),
+                                                    offset,
+                                                    length);
+                        }
+                        catch (...)
+                        {
+                            close(fd);
+                            throw;
+                        }
+                        if (m_length == 0)
+                        {
+                            close(fd);
+                            return;
+                        }
+
+                        const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+                        const std::size_t aligned_offset = offset - offset % page_size;
+                        m_mapped_length = m_length + (offset - aligned_offset);
+                        // MAP_PRIVATE makes pages copy-on-write, so the file is never modified
+                        void* data = mmap(nullptr,
+                                          m_mapped_length,
+                                          PROT_READ | PROT_WRITE,
+                                          MAP_PRIVATE,
+                                          fd,
+                                          static_cast<off_t>(aligned_offset));
+                        // the mapping stays valid after the descriptor is closed
+                        close(fd);
+                        if (data == MAP_FAILED)
+                        {
+                            throw error::tensor::invalid_external_data{
+                                external_data,
+                                std::string{"Cannot map the file: "} + std::strerror(errno)};
+                        }
+                        m_view = data;
+                        m_data = static_cast<char*>(data) + (offset - aligned_offset);
+                    }
+
+                    ~MappedFileRegion()
+                    {
+                        if (m_view != nullptr)
+                        {
+                            munmap(m_view, m_mapped_length);
+                        }
+                    }
+#endif
+
+                    char* data() const { return m_data; }
+                    std::size_t size() const { return m_length; }
+                private:
+                    static std::size_t check_length(const TensorExternalData& external_data,
+                                                    std::size_t file_size,
+                                                    std::size_t offset,
+                                                    std::size_t length)
+                    {
+                        if (offset > file_size || length > file_size - offset)
+                        {
+                            throw error::tensor::invalid_external_data{
+                                external_data,
+                                "The data exceeds the file of " + std::to_string(file_size) +
+                                    " bytes"};
+                        }
+                        return length == 0 ? file_size - offset : length;
+                    }
+
+                    void* m_view{nullptr};
+                    char* m_data{nullptr};
+                    std::size_t m_length{0};
+#ifdef _WIN32
+                    HANDLE m_mapping{nullptr};
+#else
+                    std::size_t m_mapped_length{0};
+#endif
+                };
+
+                std::string get_model_directory(const std::string& model_path)
+                {
+                    const auto pos = model_path.find_last_of("/\\");
+                    return pos == std::string::npos ? std::string{} : model_path.substr(0, pos);
+                }
+
+                void update_external_data_paths(ONNX_NAMESPACE::TensorProto& tensor,
+                                                const std::string& model_dir)
+                {
+                    if (!has_external_data(tensor))
+                    {
+                        return;
+                    }
+                    for (auto& entry : *tensor.mutable_external_data())
+                    {
+                        if (entry.key() == "location")
+                        {
+                            entry.set_value(file_util::path_join(model_dir, entry.value()));
+                        }
+                    }
+                }
+
+                void update_external_data_paths(ONNX_NAMESPACE::GraphProto& graph,
+                                                const std::string& model_dir)
+                {
+                    for (auto& initializer : *graph.mutable_initializer())
+                    {
+                        update_external_data_paths(initializer, model_dir);
+                    }
+                    for (auto& node : *graph.mutable_node())
+                    {
+                        for (auto& attribute : *node.mutable_attribute())
+                        {
+                            if (attribute.has_t())
+                            {
+                                update_external_data_paths(*attribute.mutable_t(), model_dir);
+                            }
+                            for (auto& tensor : *attribute.mutable_tensors())
+                            {
+                                update_external_data_paths(tensor, model_dir);
+                            }
+                            if (attribute.has_g())
+                            {
+                                update_external_data_paths(*attribute.mutable_g(), model_dir);
+                            }
+                            for (auto& subgraph : *attribute.mutable_graphs())
+                            {
+                                update_external_data_paths(subgraph, model_dir);
+                            }
+                        }
+                    }
+                }
+            } // namespace
+
+            TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                for (const auto& entry : tensor.external_data())
+                {
+                    try
+                    {
+                        if (entry.key() == "location")
+                        {
+                            m_data_location = entry.value();
+                        }
+                        else if (entry.key() == "offset")
+                        {
+                            m_offset = std::stoull(entry.value());
+                        }
+                        else if (entry.key() == "length")
+                        {
+                            m_data_length = std::stoull(entry.value());
+                        }
+                    }
+                    catch (const std::logic_error&)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            *this, "Cannot parse value of '" + entry.key() + "' key"};
+                    }
+                }
+                if (m_data_location.empty())
+                {
+                    throw error::tensor::invalid_external_data{*this, "Location is not specified"};
+                }
+            }
+
+            std::shared_ptr<SharedDataBuffer> TensorExternalData::load_external_data() const
+            {
+                auto region = std::make_shared<MappedFileRegion>(
+                    *this, m_data_location, m_offset, m_data_length);
+                return std::make_shared<SharedDataBuffer>(region->data(), region->size(), region);
+            }
+
+            std::string TensorExternalData::to_string() const
+            {
+                std::stringstream s;
+                s << "ExternalDataInfo(";
+                s << "data_full_path: " << m_data_location;
+                s << ", offset: " << m_offset;
+                s << ", data_length: " << m_data_length;
+                s << ")";
+                return s.str();
+            }
+
+            void update_external_data_paths(ONNX_NAMESPACE::ModelProto& model_proto,
+                                            const std::string& model_path)
+            {
+                const auto model_dir = get_model_directory(model_path);
+                if (model_dir.empty())
+                {
+                    return;
+                }
+                update_external_data_paths(*model_proto.mutable_graph(), model_dir);
+            }
+        } // namespace detail
+    }     // namespace onnx_import
+} // namespace ngraph
@@ -1389,3 +1389,15 @@ TEST(constant, bad_get_data_ptr)
         EXPECT_HAS_SUBSTRING(error.what(), std::string("get_data_ptr"));
     }
 }
+
+TEST(constant, shared_data)
+{
+    auto values = make_shared<vector<float>>(vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    auto buffer = make_shared<runtime::SharedBuffer<shared_ptr<vector<float>>>>(
+        reinterpret_cast<char*>(values->data()), values->size() * sizeof(float), values);
+    auto c = make_shared<op::Constant>(element::f32, Shape{2, 2}, buffer);
+    buffer.reset();
+
+    EXPECT_EQ(c->get_data_ptr(), values->data());
+    EXPECT_EQ(c->get_vector<float>(), *values);
+}
@@ -192,6 +192,58 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data)
+{
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1, 1, 1, 1});
+    test_case.add_expected_output<float>({7, 9, 11, 13});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_from_stream)
+{
+    const auto model_path =
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt");
+    std::ifstream model_stream{model_path, std::ios::in | std::ios::binary};
+    ASSERT_TRUE(model_stream.is_open());
+    auto function = onnx_import::import_onnx_model(model_stream, model_path);
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1, 1, 1, 1});
+    test_case.add_expected_output<float>({7, 9, 11, 13});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_file_not_found)
+{
+    try
+    {
+        onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_file_not_found.prototxt"));
+        FAIL() << "Incorrect path to external data not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("not_existed_file.data"));
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("Cannot open the file"));
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_incorrect_length)
+{
+    EXPECT_THROW(onnx_import::import_onnx_model(file_util::path_join(
+                     SERIALIZED_ZOO, "onnx/external_data/external_data_incorrect_length.prototxt")),
+                 ngraph_error)
+        << "External data exceeding the data file is not accepted.";
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_override_op)
 {
     onnx_import::register_operator(